@@ -0,0 +1,446 @@
+/**
+ * @file automaton.cpp
+ *
+ * @brief Implements methods for the `Automaton` class.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#include "automaton.hpp"
+
+#include <bitset>
+using namespace std;
+
+/* the pattern is compiled to a nondeterministic automaton over bytes, in the
+style of a Thompson construction: characters become the byte ranges of their
+UTF-8 encodings (see `CodePointSet::utf8Sequences`), and alternation and
+repetition become SPLIT instructions whose `next` is the preferred branch.
+the bytes in a character set (see `CharSet`) come after its code points, as
+RANGE instructions, and its stray bytes after those, as STRAY instructions.
+
+each state of the deterministic automaton is an ordered list of threads: the
+instructions the nondeterministic automaton could be at, most preferred first,
+which is the order a backtracking matcher like `std::regex` would try them in.
+a state that contains a MATCH thread means the pattern matches the input so
+far, and the threads after it are dropped since a backtracking matcher would
+never get to them. the last accepting state reached is the match. this is the
+"leftmost-first" construction used by RE2. */
+
+// ==================
+// Automaton methods
+// ==================
+
+// defined here since `vector::resize` takes a reference
+const int Automaton::unknown;
+
+// constructor
+Automaton::Automaton()
+    : entry(0), strays(false), classCount(0), start(dead), stateMemory(0),
+      generation(0) {}
+
+// append an instruction
+unsigned int Automaton::add(Instruction::Op op, unsigned int next,
+                            unsigned int alt)
+{
+    Instruction instruction;
+    instruction.op = op;
+    instruction.lo = 0;
+    instruction.hi = 0;
+    instruction.next = next;
+    instruction.alt = alt;
+    program.push_back(instruction);
+    return program.size() - 1;
+}
+
+// append instructions matching UTF-8 sequences
+unsigned int Automaton::emitSequences(
+    const vector<vector<ByteRange>> &sequences, size_t begin, size_t end,
+    size_t depth, unsigned int next)
+{
+    // sequences that share a range at `depth` share its instruction
+    vector<unsigned int> alternatives;
+    for (size_t i = begin; i < end;)
+    {
+        size_t j = i + 1;
+        while (j < end && sequences[j][depth] == sequences[i][depth])
+            j++;
+
+        unsigned int after = next;
+        if (depth + 1 < sequences[i].size())
+            after = emitSequences(sequences, i, j, depth + 1, next);
+
+        unsigned int pc = add(Instruction::RANGE, after);
+        program[pc].lo = sequences[i][depth].first;
+        program[pc].hi = sequences[i][depth].second;
+        alternatives.push_back(pc);
+
+        i = j;
+    }
+
+    // the alternatives match different bytes, so their order doesn't matter
+    unsigned int pc = alternatives.back();
+    for (size_t i = alternatives.size() - 1; i-- > 0;)
+    {
+        pc = add(Instruction::SPLIT, alternatives[i], pc);
+    }
+    return pc;
+}
+
+// append instructions consuming runs of bytes
+void Automaton::emitBytes(Instruction::Op op, const bitset<256> &bytes,
+                          unsigned int next, vector<unsigned int> &alternatives)
+{
+    for (unsigned int b = 0; b < 256; b++)
+    {
+        if (!bytes[b])
+            continue;
+        unsigned int pc = add(op, next);
+        program[pc].lo = b;
+        while (b + 1 < 256 && bytes[b + 1])
+            b++;
+        program[pc].hi = b;
+        alternatives.push_back(pc);
+    }
+}
+
+// append instructions matching a character from a set
+unsigned int Automaton::emitChars(const CharSet &chars, unsigned int next)
+{
+    vector<unsigned int> alternatives;
+    vector<vector<ByteRange>> sequences = chars.codePoints.utf8Sequences();
+    if (!sequences.empty())
+        alternatives.push_back(
+            emitSequences(sequences, 0, sequences.size(), 0, next));
+    emitBytes(Instruction::RANGE, chars.bytes, next, alternatives);
+    emitBytes(Instruction::STRAY, chars.strays, next, alternatives);
+
+    if (alternatives.empty())
+        return add(Instruction::FAIL);
+
+    // a byte can also start the encoding of a code point, so the order
+    // matters here
+    unsigned int pc = alternatives.back();
+    for (size_t i = alternatives.size() - 1; i-- > 0;)
+    {
+        pc = add(Instruction::SPLIT, alternatives[i], pc);
+    }
+    return pc;
+}
+
+// append instructions matching the pattern rooted at a node
+unsigned int Automaton::emit(const PatternNode *node, unsigned int next)
+{
+    // stop once the pattern is too large; `compile` checks the size
+    if (program.size() > maxInstructions)
+        return next;
+
+    switch (node->kind)
+    {
+    case PatternNode::CHARS:
+        return emitChars(node->chars, next);
+
+    case PatternNode::CONCAT:
+        // built back to front, so each child knows what comes after it
+        for (auto it = node->children.rbegin(); it != node->children.rend();
+             it++)
+        {
+            next = emit(*it, next);
+        }
+        return next;
+
+    case PatternNode::ALTERNATE:
+    {
+        unsigned int pc = emit(node->children.back(), next);
+        for (size_t i = node->children.size() - 1; i-- > 0;)
+        {
+            pc = add(Instruction::SPLIT, emit(node->children[i], next), pc);
+        }
+        return pc;
+    }
+
+    case PatternNode::REPEAT:
+    {
+        const PatternNode *child = node->children.front();
+        unsigned int pc = next;
+
+        if (node->max == PatternInfo::unbounded)
+        {
+            // a loop, choosing between another repetition and leaving
+            unsigned int loop = add(Instruction::SPLIT);
+            unsigned int body = emit(child, loop);
+            program[loop].next = node->greedy ? body : next;
+            program[loop].alt = node->greedy ? next : body;
+            pc = loop;
+        }
+        else
+        {
+            // optional repetitions, each of which may be followed by another
+            for (unsigned int i = node->min;
+                 i < node->max && program.size() <= maxInstructions; i++)
+            {
+                unsigned int body = emit(child, pc);
+                pc = node->greedy ? add(Instruction::SPLIT, body, next)
+                                  : add(Instruction::SPLIT, next, body);
+            }
+        }
+
+        // required repetitions
+        for (unsigned int i = 0;
+             i < node->min && program.size() <= maxInstructions; i++)
+        {
+            pc = emit(child, pc);
+        }
+        return pc;
+    }
+
+    case PatternNode::GROUP:
+        return emit(node->children.front(), next);
+
+    default:
+        // EMPTY (assertions and opaque nodes are rejected by `compile`)
+        return next;
+    }
+}
+
+// add the threads reachable from an instruction
+void Automaton::addThreads(vector<unsigned int> &threads, unsigned int pc)
+{
+    // depth first, preferred branch first, like a backtracking matcher
+    vector<unsigned int> stack(1, pc);
+    while (!stack.empty())
+    {
+        pc = stack.back();
+        stack.pop_back();
+        if (marks[pc] == generation)
+            continue;
+        marks[pc] = generation;
+
+        const Instruction &instruction = program[pc];
+        if (instruction.op == Instruction::SPLIT)
+        {
+            stack.push_back(instruction.alt);
+            stack.push_back(instruction.next);
+        }
+        else if (instruction.op != Instruction::FAIL)
+        {
+            threads.push_back(pc);
+        }
+    }
+}
+
+// find or add the state with a list of threads
+unsigned int Automaton::addState(const vector<unsigned int> &threads)
+{
+    auto found = stateIndex.find(threads);
+    if (found != stateIndex.end())
+        return found->second;
+
+    unsigned int state = states.size();
+    states.push_back(threads);
+    stateIndex[threads] = state;
+    accepting.push_back(!threads.empty() &&
+                        program[threads.back()].op == Instruction::MATCH);
+    transitions.resize(transitions.size() + classCount, unknown);
+
+    // the threads are stored twice (in the state and the index), and map
+    // nodes have three links
+    stateMemory += 2 * (sizeof(vector<unsigned int>) +
+                        threads.size() * sizeof(unsigned int)) +
+                   3 * sizeof(void *) + sizeof(unsigned int) +
+                   classCount * sizeof(int);
+    return state;
+}
+
+// work out the transition from a state on an equivalence class
+unsigned int Automaton::step(unsigned int state, unsigned int cls)
+{
+    if (++generation == 0)
+    {
+        marks.assign(marks.size(), 0);
+        generation = 1;
+    }
+
+    // every symbol in the class behaves the same, so any of them will do
+    unsigned int symbol = classSymbols[cls];
+    bool stray = symbol >= 256;
+    unsigned int b = stray ? symbol - 0x80 : symbol;
+    vector<unsigned int> threads;
+    for (unsigned int pc : states[state])
+    {
+        const Instruction &instruction = program[pc];
+        if ((instruction.op == Instruction::RANGE ||
+             (instruction.op == Instruction::STRAY && stray)) &&
+            instruction.lo <= b && b <= instruction.hi)
+            addThreads(threads, instruction.next);
+    }
+
+    // threads after a match can never be preferred to it
+    for (size_t i = 0; i < threads.size(); i++)
+    {
+        if (program[threads[i]].op == Instruction::MATCH)
+        {
+            threads.resize(i + 1);
+            break;
+        }
+    }
+
+    unsigned int target = addState(threads);
+    transitions[(size_t)state * classCount + cls] = target;
+    return target;
+}
+
+// discard every state but the dead state and the start state
+void Automaton::flush()
+{
+    states.clear();
+    stateIndex.clear();
+    accepting.clear();
+    transitions.clear();
+    stateMemory = 0;
+
+    addState(vector<unsigned int>());
+    start = addState(startThreads);
+}
+
+// build an automaton for a pattern
+Automaton *Automaton::compile(const PatternNode *root)
+{
+    // assertions and backreferences depend on more than the current thread
+    vector<const PatternNode *> nodes(1, root);
+    while (!nodes.empty())
+    {
+        const PatternNode *node = nodes.back();
+        nodes.pop_back();
+        if (node->kind == PatternNode::ASSERTION ||
+            node->kind == PatternNode::OPAQUE)
+            return nullptr;
+        nodes.insert(nodes.end(), node->children.begin(),
+                     node->children.end());
+    }
+
+    Automaton *automaton = new Automaton();
+    unsigned int match = automaton->add(Instruction::MATCH);
+    automaton->entry = automaton->emit(root, match);
+    if (automaton->program.size() > maxInstructions)
+    {
+        delete automaton;
+        return nullptr;
+    }
+
+    automaton->prepare();
+    return automaton;
+}
+
+// work out the equivalence classes and the start state
+void Automaton::prepare()
+{
+    // symbols are in the same class unless a range starts or ends between
+    // them. a RANGE consumes the stray form of its bytes too; a STRAY only
+    // consumes that
+    bitset<symbolCount + 1> boundaries;
+    strays = false;
+    for (const Instruction &instruction : program)
+    {
+        unsigned int lo = max(instruction.lo, (unsigned char)0x80);
+        if (instruction.op == Instruction::RANGE)
+        {
+            boundaries.set(instruction.lo);
+            boundaries.set(instruction.hi + 1);
+        }
+        else if (instruction.op != Instruction::STRAY)
+        {
+            continue;
+        }
+        else
+        {
+            strays = true;
+        }
+        if (instruction.hi >= lo)
+        {
+            boundaries.set(lo + 0x80);
+            boundaries.set(instruction.hi + 0x80 + 1);
+        }
+    }
+    unsigned int cls = 0;
+    for (unsigned int symbol = 0; symbol < symbolCount; symbol++)
+    {
+        if (symbol > 0 && boundaries[symbol])
+            cls++;
+        classes[symbol] = cls;
+        classSymbols[cls] = symbol;
+    }
+    classCount = cls + 1;
+
+    // matches of the empty string are never tokens, so the start state drops
+    // its MATCH thread but (unlike other states) keeps the threads after it
+    marks.assign(program.size(), 0);
+    generation = 1;
+    startThreads.clear();
+    addThreads(startThreads, entry);
+    for (auto it = startThreads.begin(); it != startThreads.end(); it++)
+    {
+        if (program[*it].op == Instruction::MATCH)
+        {
+            startThreads.erase(it);
+            break;
+        }
+    }
+
+    flush();
+}
+
+// match the pattern at a position in a string
+size_t Automaton::match(const string &s, size_t position)
+{
+    const unsigned char *bytes = (const unsigned char *)s.data();
+    unsigned int state = start;
+    size_t length = 0;
+
+    for (size_t i = position; i < s.size() && state != (unsigned int)dead;
+         i++)
+    {
+        // bytes that don't start a valid encoding are read as stray symbols
+        // (only checked for if the pattern cares)
+        unsigned int symbol = bytes[i];
+        if (symbol >= 0x80 && strays)
+        {
+            size_t end = i;
+            CodePointSet::decode(s, end);
+            if (end == i + 1)
+                symbol += 0x80;
+        }
+
+        unsigned int cls = classes[symbol];
+        int next = transitions[(size_t)state * classCount + cls];
+        if (next != unknown)
+        {
+            state = next;
+        }
+        else
+        {
+            // the states grow with the variety of the input; if there are
+            // too many, start again from the current state before adding one
+            if (states.size() >= maxStates)
+            {
+                vector<unsigned int> threads = states[state];
+                flush();
+                state = addState(threads);
+            }
+            state = step(state, cls);
+        }
+        if (accepting[state])
+            length = i + 1 - position;
+    }
+
+    return length;
+}
+
+// estimated memory used by the automaton
+size_t Automaton::memory() const
+{
+    return sizeof(Automaton) + program.capacity() * sizeof(Instruction) +
+           (marks.capacity() + startThreads.capacity()) * sizeof(unsigned int) +
+           stateMemory;
+}
+
+//
@@ -0,0 +1,226 @@
+/**
+ * @file automaton.hpp
+ *
+ * @brief Declares the `Automaton` class, used by the lexer to match token
+ * type patterns one byte at a time.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#ifndef __AUTOMATON_HPP__
+#define __AUTOMATON_HPP__
+
+#include "pattern.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+using namespace std;
+
+/// @brief A deterministic automaton that matches a pattern against UTF-8
+/// text one byte at a time, finding the same matches as `std::regex` would
+/// (the first alternative that matches, and greedy or lazy repetition). The
+/// states are built lazily, the first time the input reaches them, so text
+/// that only exercises part of a pattern (e.g. ASCII text, with a pattern that
+/// also accepts other scripts) only pays for that part. Bytes that the pattern
+/// doesn't tell apart share an equivalence class, and the transition table has
+/// one column per class rather than one per byte.
+///
+/// The input is read as symbols: each byte is its own symbol, except that a
+/// byte from 80 up that doesn't start a valid UTF-8 encoding is read as a
+/// separate "stray" symbol when the pattern has `STRAY` instructions (see
+/// `CharSet`).
+class Automaton
+{
+    // the lexer saves and loads programs with its tables
+    friend class Lexer;
+
+private:
+    /// @brief An instruction of the nondeterministic automaton that the states
+    /// are built from.
+    struct Instruction
+    {
+        /// @brief The kinds of instructions.
+        enum Op
+        {
+            /// @brief Consume a byte from `lo` to `hi`, then go to `next`.
+            RANGE,
+            /// @brief Consume a stray byte from `lo` to `hi` (from 80 up),
+            /// then go to `next`.
+            STRAY,
+            /// @brief Go to `next`, or failing that, to `alt`.
+            SPLIT,
+            /// @brief The pattern has matched.
+            MATCH,
+            /// @brief Never matches.
+            FAIL
+        };
+
+        /// @brief The kind of instruction.
+        Op op;
+
+        /// @brief The bytes consumed by a `RANGE` or `STRAY` instruction.
+        unsigned char lo, hi;
+
+        /// @brief The instruction to go to next.
+        unsigned int next;
+
+        /// @brief The instruction to go to if `next` fails (`SPLIT` only).
+        unsigned int alt;
+    };
+
+    /// @brief Value of a transition that hasn't been worked out yet.
+    static const int unknown = -1;
+
+    /// @brief The state that has no threads left; it never matches.
+    static const int dead = 0;
+
+    /// @brief Number of states kept before they are discarded (even in the
+    /// middle of a match) and rebuilt as they are needed again.
+    static const size_t maxStates = 4096;
+
+    /// @brief Number of symbols: the bytes, then the stray bytes from 80 up.
+    static const unsigned int symbolCount = 256 + 128;
+
+    /// @brief Largest number of instructions a pattern can compile to; larger
+    /// patterns (e.g. large counted repetitions) are left to `std::regex`.
+    static const size_t maxInstructions = 50000;
+
+    /// @brief The instructions.
+    vector<Instruction> program;
+
+    /// @brief Instruction that the pattern starts at.
+    unsigned int entry;
+
+    /// @brief Whether the program has `STRAY` instructions, i.e. whether the
+    /// input must be checked for stray bytes.
+    bool strays;
+
+    /// @brief The equivalence class of each symbol.
+    unsigned short classes[symbolCount];
+
+    /// @brief A symbol in each equivalence class.
+    unsigned short classSymbols[symbolCount];
+
+    /// @brief Number of equivalence classes.
+    unsigned int classCount;
+
+    /// @brief The threads of the start state (see `states`).
+    vector<unsigned int> startThreads;
+
+    /// @brief The start state.
+    unsigned int start;
+
+    /// @brief For each state, its threads: the `RANGE`, `STRAY` and `MATCH`
+    /// instructions the pattern could be at, in order of preference. Threads
+    /// after a `MATCH` are dropped, since they can never be preferred to it.
+    vector<vector<unsigned int>> states;
+
+    /// @brief Index in `states` of each list of threads.
+    map<vector<unsigned int>, unsigned int> stateIndex;
+
+    /// @brief Whether each state's threads include a `MATCH`.
+    vector<bool> accepting;
+
+    /// @brief The state each state goes to on each equivalence class, or
+    /// `unknown`; `classCount` entries per state.
+    vector<int> transitions;
+
+    /// @brief Estimated memory used by the states, in bytes.
+    size_t stateMemory;
+
+    /// @brief For each instruction, the value of `generation` when it was
+    /// last added to a list of threads.
+    vector<unsigned int> marks;
+
+    /// @brief Incremented each time a list of threads is built.
+    unsigned int generation;
+
+    /// @brief Constructor.
+    Automaton();
+
+    /// @brief Append an instruction to the program.
+    /// @param op The kind of instruction.
+    /// @param next The instruction to go to next.
+    /// @param alt The instruction to go to if `next` fails.
+    /// @return The index of the instruction.
+    unsigned int add(Instruction::Op op, unsigned int next = 0,
+                     unsigned int alt = 0);
+
+    /// @brief Append instructions that match the UTF-8 sequences
+    /// `sequences[begin, end)` from the range at `depth` on, then go to
+    /// `next`.
+    /// @return The instruction to start at.
+    unsigned int emitSequences(const vector<vector<ByteRange>> &sequences,
+                               size_t begin, size_t end, size_t depth,
+                               unsigned int next);
+
+    /// @brief Append instructions that match a single character from a set,
+    /// then go to `next`.
+    /// @param chars The set.
+    /// @param next The instruction to go to after the character.
+    /// @return The instruction to start at.
+    unsigned int emitChars(const CharSet &chars, unsigned int next);
+
+    /// @brief Append instructions that match the pattern rooted at a node,
+    /// then go to `next`.
+    /// @param node The node.
+    /// @param next The instruction to go to after the pattern has matched.
+    /// @return The instruction to start at.
+    unsigned int emit(const PatternNode *node, unsigned int next);
+
+    /// @brief Add the threads reachable from an instruction without consuming
+    /// input, in order of preference, to a list of threads. Threads already
+    /// in the list (since `generation` was last incremented) aren't added
+    /// again.
+    /// @param threads The list of threads.
+    /// @param pc The instruction.
+    void addThreads(vector<unsigned int> &threads, unsigned int pc);
+
+    /// @brief Find or add the state with a list of threads.
+    /// @param threads The threads.
+    /// @return The state.
+    unsigned int addState(const vector<unsigned int> &threads);
+
+    /// @brief Append an instruction consuming each run of bytes in a set.
+    /// @param op `RANGE` or `STRAY`.
+    /// @param bytes The set.
+    /// @param next The instruction to go to after the byte.
+    /// @param alternatives The instructions, appended in order.
+    void emitBytes(Instruction::Op op, const bitset<256> &bytes,
+                   unsigned int next, vector<unsigned int> &alternatives);
+
+    /// @brief Work out the transition from a state on an equivalence class.
+    /// @param state The state.
+    /// @param cls The equivalence class.
+    /// @return The state the transition goes to.
+    unsigned int step(unsigned int state, unsigned int cls);
+
+    /// @brief Discard every state but the dead state and the start state.
+    void flush();
+
+    /// @brief Work out the equivalence classes and the start state once the
+    /// program is complete.
+    void prepare();
+
+public:
+    /// @brief Build an automaton for a pattern.
+    /// @param root The root of the pattern's syntax tree.
+    /// @return The automaton, owned by the caller, or `nullptr` if the pattern
+    /// uses syntax that automata can't match (assertions and backreferences)
+    /// or is too large.
+    static Automaton *compile(const PatternNode *root);
+
+    /// @brief Match the pattern at a position in a string.
+    /// @param s The string.
+    /// @param position The position the match must start at.
+    /// @return The length of the match, or 0 if the pattern doesn't match (or
+    /// only matches the empty string).
+    size_t match(const string &s, size_t position);
+
+    /// @brief Get the estimated memory used by the automaton.
+    /// @return The memory used in bytes.
+    size_t memory() const;
+};
+
+#endif
@@ -7,6 +7,8 @@
  */
 #include "lexer.hpp"
 
+#include <algorithm>
+#include <fstream>
 #include <sstream>
 using namespace std;
 
@@ -17,13 +19,33 @@ using namespace std;
 
 #endif
 
+// ===================
+// LexerMemory methods
+// ===================
+
+// total memory used
+size_t LexerMemory::total() const
+{
+    return sources + candidates + tokens + matcher;
+}
+
+// ========================
+// LexerMemoryError methods
+// ========================
+
+// constructor
+LexerMemoryError::LexerMemoryError(const string &what) : runtime_error(what) {}
+
 // =============
 // Lexer methods
 // =============
 
+// estimated size of a node in a `list` of pointers
+static const size_t listNodeSize = 3 * sizeof(void *);
+
 // handle unmatched input by throwing a runtime error
-void Lexer::handleUnmatched(const string *const s, unsigned int position,
-                            unsigned int length)
+void Lexer::handleUnmatched(const string *const s, size_t position,
+                            size_t length)
 {
     ostringstream ss;
     ss << "Lexer Error: unmatched input \"" << s->substr(position, length);
@@ -34,145 +56,968 @@ void Lexer::handleUnmatched(const string *const s, unsigned int position,
 // register a token type with the lexer
 void Lexer::registerTokenType(const TokenType *tokenType)
 {
-    tokenTypes.push_back(tokenType);
+    RegisteredTokenType registered;
+    registered.tokenType = tokenType;
+    registered.id = tokenTypes.size();
+    registered.automaton = nullptr;
+    registered.patCompiled = false;
+    registered.groupPatCompiled = false;
+    registered.kept = 0;
+
+    // take the token type's record from the loaded tables if they have one
+    // for it; if they don't, they are stale and the rest is ignored
+    unsigned int record = registered.id;
+    if (record < loadedTables.size() &&
+        readRecord(loadedTables[record], tokenType, registered))
+    {
+        typesFromTables++;
+    }
+    else
+    {
+        registered.info = PatternInfo::analyse(tokenType->pat);
+        loadedTables.clear();
+    }
+
+    tokenTypes.push_back(registered);
+
+    // add the new token type to each entry in the table for all token types
+    // (token type sets made before now don't include it). it has the highest
+    // id, so unless its kept count came from loaded tables it goes at the back
+    for (unsigned int b = 0; b < 256; b++)
+    {
+        if (!registered.info.firstBytes[b])
+            continue;
+
+        vector<unsigned int> &entry = dispatchTables.front().entries[b];
+        auto it = entry.end();
+        while (it != entry.begin() && triedBefore(registered.id, *prev(it)))
+            it--;
+        entry.insert(it, registered.id);
+    }
+
+    countMatcherMemory();
+}
+
+// compare token types by the order they should be tried in
+bool Lexer::triedBefore(unsigned int a, unsigned int b) const
+{
+    if (tokenTypes[a].kept != tokenTypes[b].kept)
+        return tokenTypes[a].kept > tokenTypes[b].kept;
+    return a < b;
+}
+
+// sort the dispatch tables so frequently kept token types are tried first
+void Lexer::reorderDispatch()
+{
+    auto cmp = [this](unsigned int a, unsigned int b)
+    {
+        return triedBefore(a, b);
+    };
+
+    for (DispatchTable &table : dispatchTables)
+    {
+        for (vector<unsigned int> &entry : table.entries)
+        {
+            sort(entry.begin(), entry.end(), cmp);
+        }
+    }
+
+    keptSinceReorder = 0;
 }
 
-// find candidate tokens for a string and add them to the candidates list
-void Lexer::findCandidates(const string *s)
+// recount the memory used by the matcher
+void Lexer::countMatcherMemory()
 {
-    for (const TokenType *tokenType : tokenTypes)
+    memory.matcher = tokenTypes.capacity() * sizeof(RegisteredTokenType) +
+                     dispatchTables.capacity() * sizeof(DispatchTable) +
+                     loadedTables.capacity() * sizeof(const char *) +
+                     tablesFile.capacity() +
+                     emptyGroupPats.capacity() * sizeof(regex);
+
+    for (const RegisteredTokenType &tokenType : tokenTypes)
     {
-        regex pat = regex(tokenType->pat);
-        sregex_iterator it(s->begin(), s->end(), pat);
-        sregex_iterator end;
+        memory.matcher += tokenType.regexPat.capacity();
+        if (tokenType.automaton != nullptr)
+            memory.matcher += tokenType.automaton->memory();
+    }
 
-        for (; it != end; it++)
+    for (const DispatchTable &table : dispatchTables)
+    {
+        for (const vector<unsigned int> &entry : table.entries)
         {
-            CandidateToken *candidate = new CandidateToken(tokenType, *it, s);
-            candidates.push_back(candidate);
+            memory.matcher += entry.capacity() * sizeof(unsigned int);
         }
     }
+
+    // map nodes hold a key (a bitset with one bit per token type), a value
+    // and three links
+    memory.matcher += tableIndex.size() *
+                      (sizeof(vector<bool>) + tokenTypes.size() / 8 +
+                       sizeof(unsigned int) + listNodeSize);
+}
+
+// count the memory used by tokens
+size_t Lexer::tokenMemory() const
+{
+    return (tokens.size() + spareTokens.size()) * listNodeSize +
+           tokens.size() * sizeof(BaseToken);
+}
+
+// recount the memory used by candidates and tokens
+void Lexer::countTokenMemory()
+{
+    memory.candidates = candidates.capacity() * sizeof(CandidateToken) +
+                        (best.size() + scratch.size() + sourceMatch.size() +
+                         groupsMatch.size()) *
+                            sizeof(ssub_match);
+    memory.tokens = tokenMemory();
+}
+
+// update the peak memory used and enforce the budget
+void Lexer::checkMemory(size_t extra)
+{
+    // token queues free tokens without the lexer knowing, so recount them
+    memory.tokens = tokenMemory();
+    size_t total = memory.total() + extra;
+
+    if (memoryBudget != 0 && total > memoryBudget)
+    {
+        ostringstream ss;
+        ss << "Lexer Error: memory budget of " << memoryBudget;
+        ss << " bytes exceeded (" << total << " bytes needed)";
+        throw LexerMemoryError(ss.str());
+    }
+
+    if (total > peakMemory)
+        peakMemory = total;
 }
 
-// sort candidates by their starting positions
-void Lexer::sortCandidates()
+// compile a token type's pattern for scanning
+void Lexer::compile(RegisteredTokenType &tokenType)
 {
-    candidates.sort(CandidateToken::cmpPos);
+    // patterns loaded from tables are already translated for std::regex (and
+    // are only compiled here if they have no automaton). note: parsing throws
+    // on an invalid pattern
+    if (tokenType.regexPat.empty())
+    {
+        PatternNode *root = PatternNode::parse(tokenType.tokenType->pat);
+        tokenType.regexPat = root->toRegex();
+        tokenType.automaton = Automaton::compile(root);
+        delete root;
+    }
+
+    // patterns without an automaton are matched by std::regex. scanning only
+    // needs the extent of each match, so leave the capture groups out unless
+    // the pattern refers back to them
+    if (tokenType.automaton == nullptr)
+    {
+        regex::flag_type flags = regex::ECMAScript;
+        if (!tokenType.info.backreferences)
+            flags |= regex::nosubs;
+        tokenType.pat = regex(tokenType.regexPat, flags);
+    }
+
+    tokenType.patCompiled = true;
+    countMatcherMemory();
 }
 
-// filter out overlapping candidates
-void Lexer::filterCandidates(const string *s)
+// flags for matching a token at a position
+static regex_constants::match_flag_type matchFlags(size_t position)
 {
-    // need at least 2 tokens to compare them
-    if (candidates.size() < 2)
-        return;
+    // empty matches are never tokens; "match_prev_avail" lets anchors and
+    // word boundaries see the character before the current position
+    regex_constants::match_flag_type flags =
+        regex_constants::match_continuous | regex_constants::match_not_null;
+    if (position > 0)
+        flags |= regex_constants::match_prev_avail;
+    return flags;
+}
 
-    // adjacent candidates
-    auto it1 = candidates.begin();
-    auto it2 = next(it1);
+// find the longest match at a position
+Lexer::RegisteredTokenType *Lexer::matchAt(const string *s,
+                                           size_t position, size_t &length,
+                                           smatch &best,
+                                           smatch &scratch,
+                                           const DispatchTable &table)
+{
+    RegisteredTokenType *winner = nullptr;
+    size_t bestLength = 0;
+    size_t remaining = s->size() - position;
+    regex_constants::match_flag_type flags = matchFlags(position);
 
-    while (it2 != candidates.end())
+    unsigned char c = (*s)[position];
+    for (unsigned int id : table.entries[c])
     {
-        // helper variables
-        unsigned int end1 = (*it1)->match.position(0) + (*it1)->match.length(0);
-        unsigned int start2 = (*it2)->match.position(0);
+        RegisteredTokenType &tokenType = tokenTypes[id];
 
-        if (end1 == start2)
+        // skip token types that can't beat the best match so far
+        if (winner != nullptr)
         {
-            // first token ends where second token starts => no overlap and no
-            // unmatched input => move onto the next pair
-            it1++;
-            it2++;
+            size_t bound = tokenType.info.maxLength == PatternInfo::unbounded
+                               ? remaining
+                               : min((size_t)tokenType.info.maxLength, remaining);
+            if (bound < bestLength ||
+                (bound == bestLength && tokenType.id > winner->id))
+                continue;
         }
-        else if (end1 < start2)
-        {
-            // second token starts strictly after first token ends => handle
-            // unmatched input
-            handleUnmatched(s, end1, start2 - end1);
 
-            // if the program still exists after the call to handleUnmatched
-            // (i.e., if the handleUnmatched method has been overriden so that
-            // it doesn't throw a runtime error), move onto the next pair
-            ++it1;
-            ++it2;
+        if (!tokenType.patCompiled)
+            compile(tokenType);
+
+        size_t matched;
+        if (tokenType.automaton != nullptr)
+        {
+            // the automaton may add states as it goes (or discard them, if
+            // it has too many)
+            size_t before = tokenType.automaton->memory();
+            matched = tokenType.automaton->match(*s, position);
+            size_t after = tokenType.automaton->memory();
+            memory.matcher = memory.matcher - before + after;
+            if (after > before)
+                checkMemory();
+            if (matched == 0)
+                continue;
         }
         else
         {
-            // first token ends before second token starts => handle overlap
-            if ((*it2)->isLonger(*it1))
+            if (!regex_search(s->begin() + position, s->end(), scratch,
+                              tokenType.pat, flags))
+                continue;
+            matched = scratch.length(0);
+        }
+
+        if (winner == nullptr || matched > bestLength ||
+            (matched == bestLength && tokenType.id < winner->id))
+        {
+            winner = &tokenType;
+            bestLength = matched;
+            if (tokenType.automaton == nullptr)
+                best.swap(scratch);
+        }
+    }
+
+    length = bestLength;
+    return winner;
+}
+
+// count a kept token
+void Lexer::countKept(RegisteredTokenType *tokenType)
+{
+    // periodically let the counts reorder the dispatch tables
+    tokenType->kept++;
+    if (++keptSinceReorder == reorderInterval)
+        reorderDispatch();
+}
+
+// find the next token in a string
+Lexer::RegisteredTokenType *Lexer::findNext(const string *s,
+                                            size_t &position, size_t &length,
+                                            smatch &best, smatch &scratch,
+                                            const DispatchTable &table)
+{
+    // start of input that no token type has matched yet
+    size_t unmatched = position;
+
+    for (; position < s->size(); position++)
+    {
+        RegisteredTokenType *winner =
+            matchAt(s, position, length, best, scratch, table);
+        if (winner == nullptr)
+            continue;
+
+        // the input between the previous token and this one wasn't matched
+        if (unmatched < position)
+            handleUnmatched(s, unmatched, position - unmatched);
+
+        countKept(winner);
+        return winner;
+    }
+
+    // the input after the last token wasn't matched
+    if (unmatched < position)
+        handleUnmatched(s, unmatched, position - unmatched);
+
+    return nullptr;
+}
+
+// move a sub-match of a match made by std::regex
+static void moveSubMatch(const ssub_match &sub, string::const_iterator first,
+                         string::const_iterator second, bool matched)
+{
+    // std::smatch has no setters, but the sub-matches it returns are objects
+    // it owns rather than constants, so they can be changed in place
+    ssub_match &target = const_cast<ssub_match &>(sub);
+    target.first = first;
+    target.second = second;
+    target.matched = matched;
+}
+
+// make a match over a whole string
+void Lexer::matchWhole(const string *s, unsigned int groups, smatch &match)
+{
+    if (emptyGroupPats.size() <= groups)
+    {
+        for (size_t n = emptyGroupPats.size(); n <= groups; n++)
+        {
+            string pat;
+            for (size_t i = 0; i < n; i++)
             {
-                /* second candidate is longer => remove first candidate. */
-                delete *it1;                 // delete data in list node
-                it1 = candidates.erase(it1); // delete list node
-                it2 = next(it1);             // update it2
+                pat += "()";
             }
-            else
+            emptyGroupPats.push_back(regex(pat));
+        }
+        countMatcherMemory();
+    }
+
+    regex_search(s->begin(), s->end(), match, emptyGroupPats[groups],
+                 regex_constants::match_continuous);
+}
+
+// make the match for a kept token
+const smatch *Lexer::matchGroups(RegisteredTokenType *tokenType,
+                                 const string *s, size_t position,
+                                 size_t length, smatch &match)
+{
+    /* `lexFn` gets a match over the whole string, whichever engine found the
+    token. `std::smatch` can only be made by std::regex, but matching the
+    token again would cost time (and, since std::regex's matcher is
+    recursive, stack) in proportion to its length. instead, a match over the
+    whole string is made cheaply, by matching empty groups at its start, and
+    its sub-matches are moved to the token. */
+    string::const_iterator start = s->begin() + position;
+    string::const_iterator end = start + length;
+    smatch *whole = &sourceMatch;
+
+    if (tokenType->info.groups == 0)
+    {
+        // the same match serves every token in the string
+        if (sourceMatch.empty() || sourceMatch.prefix().first != s->begin() ||
+            sourceMatch.suffix().second != s->end())
+            matchWhole(s, 0, sourceMatch);
+    }
+    else
+    {
+        // the groups are found by std::regex: by the scan if the pattern
+        // needed them to match (for backreferences), otherwise by matching
+        // the token again
+        if (tokenType->automaton != nullptr ||
+            !tokenType->info.backreferences)
+        {
+            if (!tokenType->groupPatCompiled)
             {
-                /* first candidate is longer OR candidates are the same length
-                => remove second candidate. note that we remove the second
-                candidate in the equal length case because it will be the one
-                whose token type was registered with the lexer first. we know
-                this because the `list::sort` method in C++ performs a stable
-                sort */
-                delete *it2;                 // delete data in list node
-                it2 = candidates.erase(it2); // delete list node
-                // don't need to update it1; it2 still points to the item after
-                // it1
+                tokenType->groupPat = regex(tokenType->regexPat);
+                tokenType->groupPatCompiled = true;
+                countMatcherMemory();
             }
+            regex_search(start, s->end(), match, tokenType->groupPat,
+                         matchFlags(position));
+        }
 
-            // don't increment the iterators here since there might be more
-            // than two overlapping tokens in a row.
+        whole = &groupsMatch;
+        matchWhole(s, tokenType->info.groups, groupsMatch);
+        for (size_t i = 1; i < match.size() && i < groupsMatch.size(); i++)
+        {
+            moveSubMatch(groupsMatch[i], match[i].first, match[i].second,
+                         match[i].matched);
         }
     }
+
+    moveSubMatch(whole->prefix(), s->begin(), start, start != s->begin());
+    moveSubMatch((*whole)[0], start, end, true);
+    moveSubMatch(whole->suffix(), end, s->end(), end != s->end());
+    return whole;
+}
+
+// convert a match to a token and store it
+const BaseToken *Lexer::keep(RegisteredTokenType *tokenType, const string *s,
+                             size_t position, size_t length, smatch &match)
+{
+#ifndef NDEBUG
+    if (recordCandidates)
+        candidates.push_back(
+            CandidateToken(tokenType->tokenType, s, position, length));
+#endif
+
+    // capture groups are only worked out for tokens that are kept
+    const BaseToken *token =
+        tokenType->tokenType->lex(matchGroups(tokenType, s, position, length,
+                                              match));
+
+    // reuse a list node released by reset if there is one
+    if (spareTokens.empty())
+    {
+        tokens.push_back(token);
+    }
+    else
+    {
+        tokens.splice(tokens.end(), spareTokens, spareTokens.begin());
+        tokens.back() = token;
+    }
+
+    countTokenMemory();
+    checkMemory();
+    return token;
+}
+
+// copy a string to be lexed
+const string *Lexer::copySource(const string &_s)
+{
+    // reuse a string released by reset if there is one, so that its capacity
+    // is reused too. check the budget before copying, so that input that is
+    // too big is rejected without allocating memory for it
+    if (spareStrings.empty())
+    {
+        checkMemory(sizeof(string) + _s.size() + listNodeSize);
+        stringsLexed.push_back(new string(_s));
+        memory.sources += sizeof(string) + stringsLexed.back()->capacity() +
+                          listNodeSize;
+    }
+    else
+    {
+        string *spare = spareStrings.front();
+        size_t capacity = spare->capacity();
+        if (_s.size() > capacity)
+            checkMemory(_s.size() - capacity);
+
+        stringsLexed.splice(stringsLexed.end(), spareStrings,
+                            spareStrings.begin());
+        spare->assign(_s);
+        memory.sources += spare->capacity() - capacity;
+    }
+
+    checkMemory();
+    return stringsLexed.back();
 }
 
 // lex a string
-void Lexer::lex(string _s)
+void Lexer::lex(const string &_s)
 {
-    /* note that "_s" stores the original string which may be stack or heap
+    /* note that "_s" refers to the original string which may be stack or heap
     allocated, while "s" stores a pointer to a heap-allocated copy of the
     original string. the lexer takes ownership of the heap allocated copy by
     adding it to the "stringsLexed" list. */
-    const string *const s = new string(_s);
-    stringsLexed.push_back(s);
+    peakMemory = memoryUsage().total();
+    const string *const s = copySource(_s);
 
-    // find the candidate tokens for s and add them to the candidates list
-    findCandidates(s);
+    /* tokens are converted as soon as they are found, so the only matches
+    alive at any time are the best match at the current position and the one
+    being tried against it. */
+    size_t position = 0, length;
 
-    // sort the candidate tokens
-    sortCandidates();
+    RegisteredTokenType *tokenType;
+    while ((tokenType = findNext(s, position, length, best, scratch,
+                                 dispatchTables.front())) != nullptr)
+    {
+        keep(tokenType, s, position, length, best);
+        position += length;
+    }
+}
 
-    // filter the candidate tokens (pass `s` to generate an error message from
-    // if needed)
-    filterCandidates(s);
+// lex a string into a compact token stream
+void Lexer::lex(const string &s, TokenStream &stream)
+{
+    // tokens are only found, never converted, so the caller's string can be
+    // used as it is
+    peakMemory = memoryUsage().total();
+    size_t position = 0, length;
+    stream.startSource();
 
-    // convert the candidate tokens to tokens; add them to the list of tokens
-    for (const CandidateToken *candidate : candidates)
+    // the stream's growth counts towards the budget, checked as it grows
+    size_t streamStart = stream.memory(), streamMemory = streamStart;
+
+    RegisteredTokenType *tokenType;
+    while ((tokenType = findNext(&s, position, length, best, scratch,
+                                 dispatchTables.front())) != nullptr)
     {
-        const BaseToken *token = candidate->tokenType->lex(&candidate->match);
-        tokens.push_back(token);
+        stream.append(tokenType->tokenType, position, length);
+        position += length;
+
+        if (stream.memory() != streamMemory)
+        {
+            streamMemory = stream.memory();
+            checkMemory(streamMemory - streamStart);
+        }
+    }
+}
+
+// make a set of token types
+TokenTypeSet Lexer::tokenTypeSet(initializer_list<const TokenType *> types)
+{
+    return tokenTypeSet(vector<const TokenType *>(types));
+}
+
+// make a set of token types from a vector
+TokenTypeSet Lexer::tokenTypeSet(const vector<const TokenType *> &types)
+{
+    TokenTypeSet set;
+    set.lexer = this;
+    set.members.resize(tokenTypes.size());
+
+    for (const TokenType *type : types)
+    {
+        auto it = find_if(tokenTypes.begin(), tokenTypes.end(),
+                          [type](const RegisteredTokenType &registered)
+                          { return registered.tokenType == type; });
+        if (it == tokenTypes.end())
+        {
+            ostringstream ss;
+            ss << "Lexer Error: token type \"" << type->name;
+            ss << "\" is not registered";
+            throw runtime_error(ss.str());
+        }
+        set.members[it->id] = true;
+    }
+
+    // sets with the same members share a dispatch table; otherwise build one
+    // from the table for all token types, which is already in the right order
+    auto found = tableIndex.find(set.members);
+    if (found != tableIndex.end())
+    {
+        set.table = found->second;
+        return set;
+    }
+
+    DispatchTable table;
+    for (unsigned int b = 0; b < 256; b++)
+    {
+        for (unsigned int id : dispatchTables.front().entries[b])
+        {
+            if (id < set.members.size() && set.members[id])
+                table.entries[b].push_back(id);
+        }
+    }
+
+    set.table = dispatchTables.size();
+    dispatchTables.push_back(table);
+    tableIndex[set.members] = set.table;
+    countMatcherMemory();
+    return set;
+}
+
+// start lexing a string one token at a time
+void Lexer::open(const string &_s)
+{
+    // as in lex, the lexer owns a copy of the string
+    peakMemory = memoryUsage().total();
+    source = copySource(_s);
+    cursor = 0;
+}
+
+// lex the next token, trying every token type
+const BaseToken *Lexer::next()
+{
+    if (source == nullptr)
+        throw runtime_error("Lexer Error: no string has been opened");
+
+    // as in lex, input that no token type matches is unmatched. the cursor
+    // only moves once a token is found
+    size_t position = cursor, length;
+    RegisteredTokenType *tokenType = findNext(source, position, length, best,
+                                              scratch, dispatchTables.front());
+    if (tokenType == nullptr)
+    {
+        cursor = position;
+        return nullptr;
+    }
+
+    const BaseToken *token = keep(tokenType, source, position, length, best);
+    cursor = position + length;
+    return token;
+}
+
+// lex the next token, trying only the expected token types
+const BaseToken *Lexer::next(const TokenTypeSet &expected)
+{
+    if (source == nullptr)
+        throw runtime_error("Lexer Error: no string has been opened");
+
+    if ((expected.lexer != nullptr && expected.lexer != this) ||
+        expected.table >= dispatchTables.size())
+        throw runtime_error(
+            "Lexer Error: token type set was made by another lexer");
+
+    // only the cursor is tried, and it doesn't move unless a token is found,
+    // so the caller can try other token types
+    if (cursor >= source->size())
+        return nullptr;
+
+    size_t length;
+    RegisteredTokenType *tokenType =
+        matchAt(source, cursor, length, best, scratch,
+                dispatchTables[expected.table]);
+    if (tokenType == nullptr)
+        return nullptr;
+
+    countKept(tokenType);
+    const BaseToken *token = keep(tokenType, source, cursor, length, best);
+    cursor += length;
+    return token;
+}
+
+// check whether next has reached the end of the string
+bool Lexer::atEnd() const
+{
+    return source == nullptr || cursor >= source->size();
+}
+
+// release the tokens and strings lexed so far
+void Lexer::reset()
+{
+    // free the tokens that haven't been taken from a token queue, keeping the
+    // list nodes
+    for (const BaseToken *token : tokens)
+    {
+        delete token;
+    }
+    spareTokens.splice(spareTokens.end(), tokens);
+
+    // keep the strings (emptied, but with their capacity) for reuse
+    for (string *s : stringsLexed)
+    {
+        s->clear();
+    }
+    spareStrings.splice(spareStrings.end(), stringsLexed);
+
+    candidates.clear();
+    source = nullptr;
+    cursor = 0;
+    countTokenMemory();
+}
+
+// set a limit on the memory used by the lexer
+void Lexer::setMemoryBudget(size_t bytes)
+{
+    memoryBudget = bytes;
+}
+
+// get the memory currently used by the lexer
+LexerMemory Lexer::memoryUsage() const
+{
+    // token queues free tokens without the lexer knowing, so recount them
+    LexerMemory usage = memory;
+    usage.tokens = tokenMemory();
+    return usage;
+}
+
+// get the peak memory used by the lexer
+size_t Lexer::peakMemoryUsage() const
+{
+    return peakMemory;
+}
+
+// ===================
+// Table serialisation
+// ===================
+
+/* tables are stored little-endian regardless of the host, so they can be
+generated on one machine and embedded in programs built for another. the
+layout is:
+
+    "objlrl\0\0"            magic
+    u32                     version (tablesVersion)
+    u32                     number of records
+    per record:
+        u64                 fingerprint of the token type's name and pattern
+        32 bytes            PatternInfo::firstBytes, one bit per byte value
+        u32                 PatternInfo::maxLength
+        u32                 PatternInfo::groups
+        u8                  PatternInfo::nullable | backreferences << 1
+        u64                 number of tokens kept
+        u32                 length of the pattern translated for std::regex
+        ...                 the translated pattern
+        u32                 number of automaton instructions (0 if the
+                            pattern has no automaton)
+        u32                 instruction the automaton starts at (if it has
+                            instructions)
+        per instruction:
+            u8              Automaton::Instruction::op
+            u8, u8          lo, hi
+            u32, u32        next, alt
+
+the automaton's states and equivalence classes aren't stored, since they are
+quick to work out from its instructions (unlike the instructions themselves,
+which come from parsing the pattern and converting Unicode categories to
+UTF-8). */
+
+// magic bytes at the start of the tables
+static const char tablesMagic[8] = {'o', 'b', 'j', 'l', 'r', 'l', 0, 0};
+
+// size of the header of the tables
+static const size_t tablesHeaderSize = sizeof(tablesMagic) + 4 + 4;
+
+// size of the fixed-size fields at the start of a record
+static const size_t tableRecordSize = 8 + 32 + 4 + 4 + 1 + 8;
+
+// size of an automaton instruction in the tables
+static const size_t tableInstructionSize = 1 + 1 + 1 + 4 + 4;
+
+// append an unsigned integer in little-endian order
+static void putUnsigned(string &out, unsigned long long value, size_t bytes)
+{
+    for (size_t i = 0; i < bytes; i++)
+    {
+        out.push_back((char)(value >> (8 * i)));
+    }
+}
+
+// read an unsigned integer in little-endian order
+static unsigned long long getUnsigned(const char *data, size_t bytes)
+{
+    unsigned long long value = 0;
+    for (size_t i = 0; i < bytes; i++)
+    {
+        value |= (unsigned long long)(unsigned char)data[i] << (8 * i);
     }
+    return value;
+}
+
+// fingerprint of a token type's name and pattern (64-bit FNV-1a)
+unsigned long long Lexer::fingerprint(const TokenType *tokenType)
+{
+    unsigned long long hash = 14695981039346656037ull;
+    auto add = [&hash](const string &s)
+    {
+        // include the terminating null so that ("ab", "c") and ("a", "bc")
+        // differ
+        for (size_t i = 0; i <= s.size(); i++)
+        {
+            hash ^= (unsigned char)s.c_str()[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    add(tokenType->name);
+    add(tokenType->pat);
+    return hash;
+}
+
+// serialise the lexer's tables
+string Lexer::saveTables()
+{
+    string out(tablesMagic, sizeof(tablesMagic));
+    putUnsigned(out, tablesVersion, 4);
+    putUnsigned(out, tokenTypes.size(), 4);
+
+    for (RegisteredTokenType &tokenType : tokenTypes)
+    {
+        // the tables hold every compiled pattern, not just those used so far
+        if (!tokenType.patCompiled)
+            compile(tokenType);
+
+        putUnsigned(out, fingerprint(tokenType.tokenType), 8);
+
+        const PatternInfo &info = tokenType.info;
+        for (unsigned int b = 0; b < 256; b += 8)
+        {
+            unsigned char byte = 0;
+            for (unsigned int i = 0; i < 8; i++)
+            {
+                byte |= info.firstBytes[b + i] << i;
+            }
+            out.push_back((char)byte);
+        }
+        putUnsigned(out, info.maxLength, 4);
+        putUnsigned(out, info.groups, 4);
+        putUnsigned(out, info.nullable | info.backreferences << 1, 1);
+        putUnsigned(out, tokenType.kept, 8);
+
+        putUnsigned(out, tokenType.regexPat.size(), 4);
+        out += tokenType.regexPat;
+
+        const Automaton *automaton = tokenType.automaton;
+        if (automaton == nullptr)
+        {
+            putUnsigned(out, 0, 4);
+            continue;
+        }
+        putUnsigned(out, automaton->program.size(), 4);
+        putUnsigned(out, automaton->entry, 4);
+        for (const Automaton::Instruction &instruction : automaton->program)
+        {
+            putUnsigned(out, instruction.op, 1);
+            putUnsigned(out, instruction.lo, 1);
+            putUnsigned(out, instruction.hi, 1);
+            putUnsigned(out, instruction.next, 4);
+            putUnsigned(out, instruction.alt, 4);
+        }
+    }
+
+    return out;
+}
+
+// check the size and contents of a record, and find the end of it
+const char *Lexer::checkRecord(const char *p, const char *end)
+{
+    if ((size_t)(end - p) < tableRecordSize + 4)
+        return nullptr;
+    p += tableRecordSize;
+
+    size_t length = getUnsigned(p, 4);
+    p += 4;
+    if ((size_t)(end - p) < length + 4)
+        return nullptr;
+    p += length;
+
+    size_t count = getUnsigned(p, 4);
+    p += 4;
+    if (count == 0)
+        return p;
+
+    // the automaton's instructions must all be in its program
+    if (count > Automaton::maxInstructions ||
+        (size_t)(end - p) < 4 + count * tableInstructionSize ||
+        getUnsigned(p, 4) >= count)
+        return nullptr;
+    p += 4;
+    for (size_t i = 0; i < count; i++, p += tableInstructionSize)
+    {
+        if (getUnsigned(p, 1) > Automaton::Instruction::FAIL ||
+            getUnsigned(p + 3, 4) >= count || getUnsigned(p + 7, 4) >= count)
+            return nullptr;
+    }
+    return p;
+}
+
+// load tables written by saveTables
+bool Lexer::loadTables(const char *data, size_t size)
+{
+    if (!tokenTypes.empty() || size < tablesHeaderSize ||
+        !equal(tablesMagic, tablesMagic + sizeof(tablesMagic), data) ||
+        getUnsigned(data + 8, 4) != tablesVersion)
+        return false;
+
+    // check every record now, so reading them later can't fail; they are
+    // read in place when their token types are registered
+    size_t count = getUnsigned(data + 12, 4);
+    vector<const char *> records;
+    const char *p = data + tablesHeaderSize, *end = data + size;
+    for (size_t i = 0; i < count; i++)
+    {
+        records.push_back(p);
+        if ((p = checkRecord(p, end)) == nullptr)
+            return false;
+    }
+
+    loadedTables.swap(records);
+    countMatcherMemory();
+    return true;
+}
+
+// read a token type's record from the loaded tables
+bool Lexer::readRecord(const char *p, const TokenType *tokenType,
+                       RegisteredTokenType &registered)
+{
+    if (getUnsigned(p, 8) != fingerprint(tokenType))
+        return false;
+    p += 8;
+
+    PatternInfo &info = registered.info;
+    for (unsigned int b = 0; b < 256; b++)
+    {
+        info.firstBytes[b] = (p[b / 8] >> (b % 8)) & 1;
+    }
+    p += 32;
+
+    info.maxLength = getUnsigned(p, 4);
+    info.groups = getUnsigned(p + 4, 4);
+    info.nullable = p[8] & 1;
+    info.backreferences = (p[8] >> 1) & 1;
+    registered.kept = getUnsigned(p + 9, 8);
+    p += 17;
+
+    size_t length = getUnsigned(p, 4);
+    registered.regexPat.assign(p + 4, length);
+    p += 4 + length;
+
+    // patterns without an automaton are compiled by std::regex when they are
+    // first tried
+    size_t count = getUnsigned(p, 4);
+    if (count == 0)
+        return true;
+
+    Automaton *automaton = new Automaton();
+    automaton->entry = getUnsigned(p + 4, 4);
+    p += 8;
+    automaton->program.resize(count);
+    for (Automaton::Instruction &instruction : automaton->program)
+    {
+        instruction.op = (Automaton::Instruction::Op)getUnsigned(p, 1);
+        instruction.lo = getUnsigned(p + 1, 1);
+        instruction.hi = getUnsigned(p + 2, 1);
+        instruction.next = getUnsigned(p + 3, 4);
+        instruction.alt = getUnsigned(p + 7, 4);
+        p += tableInstructionSize;
+    }
+    automaton->prepare();
+
+    registered.automaton = automaton;
+    registered.patCompiled = true;
+    return true;
+}
+
+// load tables from a file
+bool Lexer::loadTablesFile(const string &path)
+{
+    ifstream in(path, ios::binary);
+    if (!in || !tokenTypes.empty())
+        return false;
+
+    // the tables are read in place, so the lexer keeps the file's contents
+    ostringstream ss;
+    ss << in.rdbuf();
+    tablesFile = ss.str();
+    if (loadTables(tablesFile.data(), tablesFile.size()))
+        return true;
+
+    tablesFile = string();
+    countMatcherMemory();
+    return false;
+}
+
+// check whether the loaded tables were used for every token type
+bool Lexer::usedTables() const
+{
+    return !tokenTypes.empty() && typesFromTables == tokenTypes.size();
+}
+
+// write a header that embeds tables in a program
+void Lexer::writeTablesHeader(ostream &out, const string &tables,
+                              const string &name)
+{
+    out << "// Lexer tables generated by Lexer::writeTablesHeader; pass them to\n";
+    out << "// Lexer::loadTables before registering token types.\n\n";
+    out << "#include <cstddef>\n\n";
+    out << "static const char " << name << "[] = {";
+
+    const char *digits = "0123456789abcdef";
+    for (size_t i = 0; i < tables.size(); i++)
+    {
+        unsigned char byte = tables[i];
+        out << (i % 12 == 0 ? "\n    " : " ");
+        out << "'\\x" << digits[byte >> 4] << digits[byte & 15] << "',";
+    }
+
+    out << "\n};\n\n";
+    out << "static const size_t " << name << "Size = " << tables.size()
+        << ";\n";
 }
 
 // initialise a token queue with the tokens stored in this lexer
 TokenQueue Lexer::getTokenQueue()
 {
-    return TokenQueue(&tokens);
+    return TokenQueue(&tokens, &spareTokens);
 }
 
 // destructor
 Lexer::~Lexer()
 {
-    // free strings lexed
+    // free strings lexed, and strings kept for reuse
     for (const string *s : stringsLexed)
     {
         delete s;
     }
-
-    // free candidate tokens
-    for (const CandidateToken *candidate : candidates)
+    for (const string *s : spareStrings)
     {
-        delete candidate;
+        delete s;
     }
 
     // free tokens if there are any here - note there shouldn't be because they
@@ -184,6 +1029,11 @@ Lexer::~Lexer()
         delete token;
     }
 
+    for (const RegisteredTokenType &tokenType : tokenTypes)
+    {
+        delete tokenType.automaton;
+    }
+
     // note: the token type pointers don't need to be freed since they should
     // point to static attributes in the corresponding token classes.
 }
@@ -194,13 +1044,19 @@ Lexer::~Lexer()
 // Debug-only methods
 // ==================
 
+// turn recording of candidate tokens on or off
+void Lexer::setRecordCandidates(bool record)
+{
+    recordCandidates = record;
+}
+
 // string representation of the candidate tokens
 string Lexer::candidatesString() const
 {
     ostringstream ss;
-    for (const CandidateToken *candidate : candidates)
+    for (const CandidateToken &candidate : candidates)
     {
-        ss << candidate->toString() << "\n";
+        ss << candidate.toString() << "\n";
     }
     return ss.str();
 }
@@ -10,56 +10,502 @@
 #define __LEXER_HPP__
 
 #include "token.hpp"
+#include "pattern.hpp"
+#include "automaton.hpp"
+#include "stream.hpp"
 
+#include <initializer_list>
 #include <list>
+#include <map>
+#include <ostream>
+#include <regex>
+#include <stdexcept>
+#include <vector>
 using namespace std;
 
+class Lexer;
+
+/// @brief A set of token types registered to a lexer, represented as a bitset
+/// indexed by registration order. Sets are made by `Lexer::tokenTypeSet` and
+/// can only be used with the lexer that made them; a default-constructed set
+/// holds every token type registered to whichever lexer it is used with.
+class TokenTypeSet
+{
+    friend class Lexer;
+
+private:
+    /// @brief Bit `i` is set if the `i`th token type registered to the lexer
+    /// is in the set.
+    vector<bool> members;
+
+    /// @brief Index of the lexer's dispatch table for this set (0 is the table
+    /// for every registered token type).
+    unsigned int table = 0;
+
+    /// @brief The lexer that made the set, or `nullptr` for a
+    /// default-constructed set.
+    const Lexer *lexer = nullptr;
+};
+
+/// @brief Estimated memory used by a lexer, in bytes, by what it is used for.
+/// The estimates cover the lexer's own storage; the data in token subclasses
+/// and the internals of `std::regex` aren't visible to the lexer, so tokens are
+/// counted as `BaseToken`s and patterns compiled by `std::regex` as `regex`
+/// objects.
+struct LexerMemory
+{
+    /// @brief Copies of the strings being lexed (including the capacity of
+    /// strings kept for reuse by `Lexer::reset`).
+    size_t sources = 0;
+
+    /// @brief Candidate tokens and matches.
+    size_t candidates = 0;
+
+    /// @brief Tokens and the lists that store them.
+    size_t tokens = 0;
+
+    /// @brief Registered token types, compiled patterns (including the states
+    /// of their automata), dispatch tables and loaded tables.
+    size_t matcher = 0;
+
+    /// @brief Get the total memory used.
+    /// @return The sum of the other fields.
+    size_t total() const;
+};
+
+/// @brief Runtime error thrown when lexing would take a lexer over its memory
+/// budget (see `Lexer::setMemoryBudget`).
+class LexerMemoryError : public runtime_error
+{
+public:
+    /// @brief Constructor.
+    /// @param what Description of the error.
+    LexerMemoryError(const string &what);
+};
+
 /// @brief Represents a lexer.
 class Lexer
 {
 private:
-    /// @brief Token types registered to the lexer.
-    list<const TokenType *> tokenTypes;
+    /// @brief A token type registered to the lexer, along with what the lexer
+    /// needs to match it.
+    struct RegisteredTokenType
+    {
+        /// @brief The token type.
+        const TokenType *tokenType;
+
+        /// @brief Index of the token type in registration order. Candidates
+        /// of equal length are resolved in favour of the lowest id.
+        unsigned int id;
+
+        /// @brief The automaton that matches the token type's pattern, built
+        /// the first time the token type is tried, or `nullptr` if the pattern
+        /// uses syntax that automata can't match (see `Automaton::compile`).
+        Automaton *automaton;
+
+        /// @brief The token type's pattern, rewritten for `std::regex` to
+        /// match UTF-8 text (see `PatternNode::toRegex`).
+        string regexPat;
+
+        /// @brief The token type's pattern compiled by `std::regex`, for
+        /// patterns that don't have an automaton. Capture groups are left out
+        /// unless the pattern needs them to match (i.e. it has
+        /// backreferences), since scanning only needs the extent of each
+        /// match.
+        regex pat;
+
+        /// @brief Whether the pattern has been compiled (i.e. `automaton`,
+        /// `regexPat` and, if needed, `pat` are set).
+        bool patCompiled;
+
+        /// @brief The token type's pattern with capture groups, compiled the
+        /// first time a token of this type is kept whose match doesn't come
+        /// from scanning (see `matchGroups`).
+        regex groupPat;
+
+        /// @brief Whether `groupPat` has been compiled.
+        bool groupPatCompiled;
+
+        /// @brief Static facts about the token type's pattern.
+        PatternInfo info;
+
+        /// @brief Number of tokens of this type kept by the lexer so far.
+        unsigned long kept;
+    };
+
+    /// @brief For each byte, the ids of the token types (from some set of
+    /// token types) whose patterns can start with that byte, most frequently
+    /// kept first.
+    struct DispatchTable
+    {
+        /// @brief One entry per byte.
+        vector<unsigned int> entries[256];
+    };
+
+    /// @brief Version of the format written by `saveTables`. Tables with a
+    /// different version are rejected by `loadTables`.
+    static const unsigned int tablesVersion = 4;
+
+    /// @brief Number of tokens to keep between reorderings of the dispatch
+    /// tables.
+    static const unsigned long reorderInterval = 1024;
+
+    /// @brief Token types registered to the lexer, in registration order.
+    vector<RegisteredTokenType> tokenTypes;
+
+    /// @brief Dispatch tables. The first covers every registered token type;
+    /// the rest cover the sets made by `tokenTypeSet`.
+    vector<DispatchTable> dispatchTables = vector<DispatchTable>(1);
+
+    /// @brief Index in `dispatchTables` of the table for each token type set.
+    map<vector<bool>, unsigned int> tableIndex;
+
+    /// @brief Number of tokens kept since the dispatch tables were last
+    /// reordered.
+    unsigned long keptSinceReorder = 0;
+
+    /// @brief Records in the tables passed to `loadTables`, in registration
+    /// order. They point into the caller's data, which is read in place.
+    vector<const char *> loadedTables;
+
+    /// @brief Contents of the file read by `loadTablesFile`, which
+    /// `loadedTables` points into.
+    string tablesFile;
+
+    /// @brief Number of registered token types whose records came from
+    /// `loadTables`.
+    unsigned int typesFromTables = 0;
 
     /// @brief Strings that have been processed by this lexer since it was
-    /// created.
-    list<const string *> stringsLexed;
+    /// created (or last reset).
+    list<string *> stringsLexed;
 
-    /// @brief A list of candidate tokens that this lexer might choose to lex.
-    list<const CandidateToken *> candidates;
+    /// @brief Strings released by `reset`, kept (with their capacity) to hold
+    /// copies of the next strings lexed.
+    list<string *> spareStrings;
+
+    /// @brief The string opened by `open`, or `nullptr`.
+    const string *source = nullptr;
+
+    /// @brief Position in `source` that `next` continues from.
+    size_t cursor = 0;
+
+    /// @brief The candidate tokens that this lexer has kept, in order (only
+    /// recorded in debug builds, if `setRecordCandidates` has turned it on).
+    vector<CandidateToken> candidates;
+
+    /// @brief Whether to record kept candidate tokens in `candidates`.
+    bool recordCandidates = false;
 
     /// @brief A list of tokens lexed by this lexer.
     list<const BaseToken *> tokens;
 
+    /// @brief List nodes released by `reset` and by dropping tokens from a
+    /// `TokenQueue`, reused to store the next tokens lexed.
+    list<const BaseToken *> spareTokens;
+
+    /// @brief The best match so far at the current position (see `findNext`),
+    /// kept between calls so its storage is reused.
+    smatch best;
+
+    /// @brief Space for matches that are tried and rejected, kept between
+    /// calls so its storage is reused.
+    smatch scratch;
+
+    /// @brief A match over the whole string being lexed, whose sub-matches
+    /// are moved to each token kept without capture groups (see
+    /// `matchGroups`).
+    smatch sourceMatch;
+
+    /// @brief A match over the whole string being lexed with room for the
+    /// capture groups of the token being kept.
+    smatch groupsMatch;
+
+    /// @brief Patterns of `n` empty capture groups at index `n`, for making
+    /// matches over a whole string, compiled as they are needed.
+    vector<regex> emptyGroupPats;
+
+    /// @brief Estimated memory used by the lexer.
+    LexerMemory memory;
+
+    /// @brief Highest total memory used since the start of the last call to
+    /// `lex` or `open`.
+    size_t peakMemory = 0;
+
+    /// @brief Memory budget in bytes, or 0 for no budget.
+    size_t memoryBudget = 0;
+
+    /// @brief Compare token types by the order they should be tried in:
+    /// frequently kept token types first, then in registration order.
+    /// @param a The id of a token type.
+    /// @param b The id of a token type.
+    /// @return `true` if `a` should be tried before `b`, else `false`.
+    bool triedBefore(unsigned int a, unsigned int b) const;
+
+    /// @brief Sort each entry of the dispatch tables so that frequently kept
+    /// token types are tried first (ties go to the first registered).
+    void reorderDispatch();
+
+    /// @brief Compile a token type's pattern for scanning: build its automaton,
+    /// or if it can't have one, compile it with `std::regex`. Throws a
+    /// `regex_error` if the pattern is invalid.
+    /// @param tokenType The registered token type.
+    void compile(RegisteredTokenType &tokenType);
+
+    /// @brief Compute the fingerprint of a token type's name and pattern.
+    /// @param tokenType A token type.
+    /// @return The fingerprint.
+    static unsigned long long fingerprint(const TokenType *tokenType);
+
+    /// @brief Check the size and contents of a record in tables passed to
+    /// `loadTables`.
+    /// @param record The record.
+    /// @param end End of the tables.
+    /// @return The end of the record, or `nullptr` if it is malformed.
+    static const char *checkRecord(const char *record, const char *end);
+
+    /// @brief Read a token type's record from the loaded tables: the facts
+    /// about its pattern, its kept count, and its compiled pattern.
+    /// @param record The record, already checked by `loadTables`.
+    /// @param tokenType The token type being registered.
+    /// @param registered The registered token type to fill in.
+    /// @return `true` if the record was read; `false` if its fingerprint
+    /// doesn't match the token type (i.e. the tables are stale).
+    bool readRecord(const char *record, const TokenType *tokenType,
+                    RegisteredTokenType &registered);
+
+    /// @brief Find the longest match at a position in a string. Only the
+    /// token types in `table` whose patterns can start with the byte at
+    /// `position` are tried, and the longest match (or the first registered,
+    /// among equally long matches) is returned.
+    /// @param s The string being lexed.
+    /// @param position Position the match must start at.
+    /// @param length On return, the length of the match.
+    /// @param best On return, the match if it was found by `std::regex`
+    /// (without capture groups, see `matchGroups`).
+    /// @param scratch Space for matches that are tried and rejected.
+    /// @param table Dispatch table for the token types to try.
+    /// @return The registered token type of the match, or `nullptr` if no
+    /// token type matches.
+    RegisteredTokenType *matchAt(const string *s, size_t position,
+                                 size_t &length, smatch &best,
+                                 smatch &scratch, const DispatchTable &table);
+
+    /// @brief Count a kept token towards its token type's dispatch order.
+    /// @param tokenType The registered token type of the token.
+    void countKept(RegisteredTokenType *tokenType);
+
+    /// @brief Find the next token in a string. Starting at `position`, only
+    /// the token types in `table` whose patterns can start with the byte at a
+    /// position are tried, and the longest match (or the first registered, among
+    /// equally long matches) is kept. Input skipped over to reach the token is
+    /// passed to `handleUnmatched`.
+    /// @param s The string being lexed.
+    /// @param position Position to start from; on return, the position of the
+    /// start of the token, or the length of `s` if there are no more tokens.
+    /// @param length On return, the length of the token.
+    /// @param best On return, the match for the token if it was found by
+    /// `std::regex` (without capture groups, see `matchGroups`).
+    /// @param scratch Space for matches that are tried and rejected.
+    /// @param table Dispatch table for the token types to try.
+    /// @return The registered token type of the token, or `nullptr` if there
+    /// are no more tokens.
+    RegisteredTokenType *findNext(const string *s, size_t &position,
+                                  size_t &length, smatch &best,
+                                  smatch &scratch, const DispatchTable &table);
+
+    /// @brief Make a match over a whole string, with empty capture groups.
+    /// @param s The string.
+    /// @param groups Number of capture groups.
+    /// @param match On return, the match.
+    void matchWhole(const string *s, unsigned int groups, smatch &match);
+
+    /// @brief Make the match passed to `lexFn` for a kept token: a match over
+    /// the whole string whose sub-matches are moved to the token and, if the
+    /// token type's pattern has capture groups, to the groups (found by
+    /// matching the pattern with `std::regex` from the start of the token).
+    /// @param tokenType The registered token type of the token.
+    /// @param s The string being lexed.
+    /// @param position Position of the start of the token.
+    /// @param length Length of the token.
+    /// @param match The match for the token, returned by `findNext`, which is
+    /// used to find the groups.
+    /// @return The match, which stays valid until the next token is kept.
+    const smatch *matchGroups(RegisteredTokenType *tokenType, const string *s,
+                              size_t position, size_t length, smatch &match);
+
+    /// @brief Recount the memory used by the matcher (after registering token
+    /// types, making token type sets, compiling patterns, or loading tables).
+    void countMatcherMemory();
+
+    /// @brief Count the memory used by tokens, including those freed by token
+    /// queues since the last count.
+    /// @return The memory used by tokens, in bytes.
+    size_t tokenMemory() const;
+
+    /// @brief Recount the memory used by candidates and tokens.
+    void countTokenMemory();
+
+    /// @brief Update the peak memory used, and throw a `LexerMemoryError` if
+    /// the budget is exceeded.
+    /// @param extra Memory about to be allocated, which is checked against
+    /// the budget before it is allocated.
+    void checkMemory(size_t extra = 0);
+
+    /// @brief Copy a string to be lexed into storage owned by the lexer.
+    /// @param _s The string to copy.
+    /// @return The copy.
+    const string *copySource(const string &_s);
+
+    /// @brief Convert a match found by `findNext` to a token and store it in
+    /// the `tokens` list.
+    /// @param tokenType The registered token type of the token.
+    /// @param s The string being lexed.
+    /// @param position Position of the start of the token.
+    /// @param length Length of the token.
+    /// @param match The match for the token, returned by `findNext`.
+    /// @return The token.
+    const BaseToken *keep(RegisteredTokenType *tokenType, const string *s,
+                          size_t position, size_t length, smatch &match);
+
 protected:
     /// @brief Function to handle unmatched input.
     /// @param s String representation of the program where the unmatched input
     /// was found.
     /// @param position Position of the unmatched input in the string `s`.
     /// @param length Length of the unmatched input in the string `s`.
-    void handleUnmatched(const string *s, unsigned int position,
-                         unsigned int length);
+    void handleUnmatched(const string *s, size_t position, size_t length);
 
 public:
-    /// @brief Register a token type with the lexer.
+    /// @brief Register a token type with the lexer. If tables were loaded with
+    /// `loadTables`, the token type's record is taken from them when its name
+    /// and pattern match; otherwise its pattern is analysed. Patterns are
+    /// compiled the first time they are tried (see `PatternNode::parse` for
+    /// the syntax, which adds Unicode general categories to `std::regex`'s).
     /// @param tokenType The token type to register.
     void registerTokenType(const TokenType *tokenType);
 
-    /// @brief Find all candidate tokens for a string and add them to the
-    /// `candidates` list.
-    /// @param s A string to lex.
-    void findCandidates(const string *s);
+    /// @brief Serialise the lexer's tables: for each registered token type, a
+    /// fingerprint of its name and pattern, the facts the lexer worked out
+    /// about its pattern, how often it has been kept (which seeds the
+    /// dispatch order of a lexer that loads the tables), and its compiled
+    /// pattern: the automaton's program, or the pattern translated for
+    /// `std::regex` if it has no automaton (`std::regex` has no serialisable
+    /// form, so those patterns are still compiled when first tried). Patterns
+    /// not yet compiled are compiled first.
+    /// @return The tables, as a versioned binary blob.
+    string saveTables();
+
+    /// @brief Load tables written by `saveTables`, e.g. from a memory-mapped
+    /// file or an array generated by `writeTablesHeader`. Must be called
+    /// before any token types are registered. The tables are checked now but
+    /// read in place as token types are registered, so the data must stay
+    /// valid until registration is done.
+    /// @param data The tables.
+    /// @param size Size of the tables in bytes.
+    /// @return `true` if the tables were loaded; `false` if they are malformed,
+    /// from another version, or token types have already been registered.
+    bool loadTables(const char *data, size_t size);
 
-    /// @brief Sort the candidates list by their starting positions in the
-    /// program.
-    void sortCandidates();
+    /// @brief Load tables written by `saveTables` from a file. The lexer keeps
+    /// the file's contents, which are read in place.
+    /// @param path Path to the file.
+    /// @return `true` if the tables were loaded, else `false`.
+    bool loadTablesFile(const string &path);
 
-    /// @brief Filter out overlapping candidates from the list.
-    void filterCandidates(const string *s);
+    /// @brief Indicates whether every registered token type took its record
+    /// from loaded tables. This is `false` if the tables are stale, i.e. a
+    /// token type was registered whose name or pattern differs from the one
+    /// the tables were saved with (the rest of the tables are then ignored).
+    /// @return `true` if the loaded tables were used for every token type.
+    bool usedTables() const;
+
+    /// @brief Write a C++ header that embeds tables in a program.
+    /// @param out Stream to write the header to.
+    /// @param tables Tables written by `saveTables`.
+    /// @param name Name of the array to declare; the header also declares
+    /// `<name>Size`.
+    static void writeTablesHeader(ostream &out, const string &tables,
+                                  const string &name);
 
     /// @brief Lex a string producing a list of `BaseToken` pointers.
     /// @param _s A string to lex.
-    void lex(string _s);
+    void lex(const string &_s);
+
+    /// @brief Lex a string into a compact token stream, which stores the type
+    /// and extent of each token instead of converting it to a `BaseToken`
+    /// (so the token types' `lexFn`s aren't called). The string isn't copied,
+    /// and nothing is stored in the lexer. The tokens are appended as a new
+    /// source (see `TokenStream::startSource`), so several strings can be
+    /// lexed into one stream. The stream's growth counts towards the memory
+    /// budget; if it goes over, a `LexerMemoryError` is thrown and the tokens
+    /// appended so far are kept.
+    /// @param s A string to lex.
+    /// @param stream The stream to append the tokens to.
+    void lex(const string &s, TokenStream &stream);
+
+    /// @brief Make a set of token types registered to this lexer, to pass to
+    /// `next`. Throws a runtime error if a token type isn't registered.
+    /// @param types The token types in the set.
+    /// @return The set of token types.
+    TokenTypeSet tokenTypeSet(initializer_list<const TokenType *> types);
+
+    /// @brief Make a set of token types registered to this lexer from a
+    /// vector, e.g. one built by a parser at runtime.
+    /// @param types The token types in the set.
+    /// @return The set of token types.
+    TokenTypeSet tokenTypeSet(const vector<const TokenType *> &types);
+
+    /// @brief Start lexing a string one token at a time with `next`.
+    /// @param _s A string to lex.
+    void open(const string &_s);
+
+    /// @brief Lex the next token of the string passed to `open`, trying every
+    /// registered token type. The token is stored in the lexer, as with
+    /// `lex`, and input before it that no token type matches is passed to
+    /// `handleUnmatched`.
+    /// @return The next token, or `nullptr` at the end of the string.
+    const BaseToken *next();
+
+    /// @brief Lex the next token of the string passed to `open`, trying only
+    /// the token types that can come next. The token must start where the
+    /// last one ended; if none of the expected token types match there, no
+    /// input is consumed, so other token types can be tried. Throws a runtime
+    /// error if the set was made by another lexer.
+    /// @param expected The token types that can come next.
+    /// @return The next token, or `nullptr` if none of the expected token
+    /// types match (see `atEnd` to tell if that is the end of the string).
+    const BaseToken *next(const TokenTypeSet &expected);
+
+    /// @brief Indicates whether `next` has reached the end of the string
+    /// passed to `open`.
+    /// @return `true` if there is no more input, else `false`.
+    bool atEnd() const;
+
+    /// @brief Release the tokens and strings lexed so far, so the lexer can be
+    /// reused for unrelated input. Registered token types, compiled patterns,
+    /// dispatch tables and kept counts are retained, as is the storage used
+    /// for the strings and the list nodes of the tokens (including those
+    /// dropped from a `TokenQueue`). Lexing similar input again then only
+    /// allocates the tokens made by lex functions, and the memory std::regex
+    /// uses to match patterns that have capture groups or no automaton.
+    void reset();
+
+    /// @brief Set a hard limit on the memory used by the lexer. If lexing
+    /// would go over the limit, `lex`, `open` and `next` throw a
+    /// `LexerMemoryError`; the tokens lexed so far are kept, and `reset` can
+    /// be used to release them.
+    /// @param bytes The limit in bytes, or 0 for no limit.
+    void setMemoryBudget(size_t bytes);
+
+    /// @brief Get the estimated memory currently used by the lexer.
+    /// @return The memory used, by what it is used for.
+    LexerMemory memoryUsage() const;
+
+    /// @brief Get the highest total memory used by the lexer since the start
+    /// of the last call to `lex` or `open`.
+    /// @return The peak memory used in bytes.
+    size_t peakMemoryUsage() const;
 
     /// @brief Initialise a `TokenQueue` with the tokens stored in this lexer.
     /// @return A `TokenQueue` with the tokens stored in this lexer.
@@ -69,7 +515,14 @@ public:
     ~Lexer();
 
 #ifndef DEBUG
-    /// @brief Get a string representation of the candidate tokens (debug only).
+    /// @brief Turn recording of the candidate tokens the lexer keeps on or
+    /// off (debug only). Recording is off by default, since the candidates
+    /// take memory for every token lexed.
+    /// @param record Whether to record the candidate tokens.
+    void setRecordCandidates(bool record);
+
+    /// @brief Get a string representation of the candidate tokens recorded
+    /// since the lexer was created or last reset (debug only).
     /// @return A string representation of the candidate tokens.
     string candidatesString() const;
 
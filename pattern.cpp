@@ -0,0 +1,1049 @@
+/**
+ * @file pattern.cpp
+ *
+ * @brief Implements methods for the `CharSet`, `PatternNode` and
+ * `PatternInfo` structs.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#include "pattern.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <regex>
+using namespace std;
+
+// ===============
+// Parsing helpers
+// ===============
+
+/* the parser is a recursive descent parser for the ECMAScript grammar used by
+`std::regex`, over code points rather than bytes, plus `\p{...}` and `\P{...}`
+for Unicode general categories. it throws a `regex_error` with the same error
+code as `std::regex` for the errors it detects; anything it accepts but
+doesn't understand becomes an `OPAQUE` node, which the analysis treats as
+"could match anything". named character classes and `\d`, `\s` and `\w` are
+taken from the "C" locale (the locale `std::regex` uses unless the program
+changes the global locale), so they only contain ASCII characters. */
+
+// set of characters for a named character class such as "digit" or "w"
+static CodePointSet namedClass(const string &name, bool &known)
+{
+    CodePointSet chars;
+    known = true;
+
+    for (int c = 0; c < 128; c++)
+    {
+        bool in;
+        if (name == "alpha")
+            in = isalpha(c);
+        else if (name == "digit" || name == "d")
+            in = isdigit(c);
+        else if (name == "alnum")
+            in = isalnum(c);
+        else if (name == "space" || name == "s")
+            in = isspace(c);
+        else if (name == "upper")
+            in = isupper(c);
+        else if (name == "lower")
+            in = islower(c);
+        else if (name == "punct")
+            in = ispunct(c);
+        else if (name == "xdigit")
+            in = isxdigit(c);
+        else if (name == "blank")
+            in = isblank(c);
+        else if (name == "cntrl")
+            in = iscntrl(c);
+        else if (name == "graph")
+            in = isgraph(c);
+        else if (name == "print")
+            in = isprint(c);
+        else if (name == "w")
+            in = isalnum(c) || c == '_';
+        else
+        {
+            known = false;
+            return chars;
+        }
+
+        if (in)
+            chars.add(c);
+    }
+
+    return chars;
+}
+
+// value of a hexadecimal digit, or -1
+static int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// state of a parse in progress
+struct PatternParser
+{
+    const string &pat;
+    size_t pos;
+
+    PatternParser(const string &pat) : pat(pat), pos(0) {}
+
+    bool atEnd() const { return pos >= pat.size(); }
+
+    char peek() const { return atEnd() ? '\0' : pat[pos]; }
+
+    // consume the next character of the pattern, which must be `c`
+    void expect(char c, regex_constants::error_type error)
+    {
+        if (peek() != c || atEnd())
+            throw regex_error(error);
+        pos++;
+    }
+
+    // parse a character written as itself; bytes that aren't valid UTF-8
+    // stand for themselves, as they do for std::regex
+    void literal(CharSet &chars)
+    {
+        size_t start = pos;
+        unsigned int c = CodePointSet::decode(pat, pos);
+        if (c >= 0x80 && pos == start + 1)
+            chars.bytes.set(c);
+        else
+            chars.codePoints.add(c);
+    }
+
+    // parse an escape sequence after a backslash; on return `chars` holds the
+    // characters it matches. returns false if the escape isn't a character
+    // (i.e. it's an assertion or a backreference), in which case `kind` says
+    // what it is.
+    bool escape(CharSet &chars, PatternNode::Kind &kind, bool inClass)
+    {
+        chars = CharSet();
+        if (atEnd())
+            throw regex_error(regex_constants::error_escape);
+        char c = pat[pos++];
+        bool known;
+
+        switch (c)
+        {
+        case 'd':
+        case 's':
+        case 'w':
+            chars.codePoints = namedClass(string(1, c), known);
+            return true;
+        case 'D':
+        case 'S':
+        case 'W':
+            chars.codePoints = namedClass(string(1, tolower(c)), known);
+            chars.invert();
+            return true;
+        case 'p':
+        case 'P':
+        {
+            // \p{name} or \P{name}
+            expect('{', regex_constants::error_escape);
+            size_t close = pat.find('}', pos);
+            if (close == string::npos)
+                throw regex_error(regex_constants::error_escape);
+            if (!CodePointSet::category(pat.substr(pos, close - pos),
+                                        chars.codePoints))
+                throw regex_error(regex_constants::error_ctype);
+            pos = close + 1;
+            if (c == 'P')
+                chars.invert();
+            return true;
+        }
+        case 't':
+            chars.codePoints.add('\t');
+            return true;
+        case 'n':
+            chars.codePoints.add('\n');
+            return true;
+        case 'v':
+            chars.codePoints.add('\v');
+            return true;
+        case 'f':
+            chars.codePoints.add('\f');
+            return true;
+        case 'r':
+            chars.codePoints.add('\r');
+            return true;
+        case '0':
+            chars.codePoints.add(0);
+            return true;
+        case 'b':
+            if (inClass)
+            {
+                chars.codePoints.add('\b');
+                return true;
+            }
+            kind = PatternNode::ASSERTION;
+            return false;
+        case 'B':
+            if (inClass)
+            {
+                chars.codePoints.add('B');
+                return true;
+            }
+            kind = PatternNode::ASSERTION;
+            return false;
+        case 'c':
+            if (!atEnd() && isalpha(peek()))
+            {
+                chars.codePoints.add(pat[pos++] % 32);
+                return true;
+            }
+            chars.codePoints.add('c');
+            return true;
+        case 'x':
+        case 'u':
+        {
+            // \xHH or \uHHHH; like std::regex, \xHH is a byte
+            size_t digits = c == 'x' ? 2 : 4;
+            unsigned int value = 0;
+            for (size_t i = 0; i < digits; i++)
+            {
+                if (atEnd() || hexValue(peek()) < 0)
+                    throw regex_error(regex_constants::error_escape);
+                value = value * 16 + hexValue(pat[pos++]);
+            }
+            if (c == 'x' && value >= 0x80)
+                chars.bytes.set(value);
+            else
+                chars.codePoints.add(value);
+            return true;
+        }
+        default:
+            if (c >= '1' && c <= '9')
+            {
+                // backreference; skip the rest of the number
+                if (inClass)
+                    throw regex_error(regex_constants::error_escape);
+                while (!atEnd() && isdigit(peek()))
+                    pos++;
+                kind = PatternNode::OPAQUE;
+                return false;
+            }
+            // identity escape
+            pos--;
+            literal(chars);
+            return true;
+        }
+    }
+
+    // parse one atom of a bracket expression, e.g. "a", "\d" or "[:alpha:]".
+    // returns true if the atom is a single code point or byte (which can
+    // start a range); `raw` says which
+    bool classAtom(CharSet &chars, unsigned int &single, bool &raw)
+    {
+        chars = CharSet();
+
+        if (peek() == '\\')
+        {
+            PatternNode::Kind kind;
+            pos++;
+            escape(chars, kind, true);
+        }
+        else if (peek() == '[' && pos + 1 < pat.size() &&
+                 (pat[pos + 1] == ':' || pat[pos + 1] == '=' ||
+                  pat[pos + 1] == '.'))
+        {
+            // "[:name:]", "[=x=]" or "[.x.]"
+            char delim = pat[pos + 1];
+            pos += 2;
+            size_t close = pat.find(string(1, delim) + "]", pos);
+            if (close == string::npos)
+                throw regex_error(regex_constants::error_brack);
+            string name = pat.substr(pos, close - pos);
+            pos = close + 2;
+
+            bool known = false;
+            if (delim == ':')
+            {
+                chars.codePoints = namedClass(name, known);
+                if (!known)
+                    throw regex_error(regex_constants::error_ctype);
+                return false;
+            }
+
+            size_t start = 0;
+            if (!name.empty())
+                chars.codePoints.add(CodePointSet::decode(name, start));
+            if (name.empty() || start != name.size())
+                throw regex_error(regex_constants::error_collate);
+        }
+        else
+        {
+            literal(chars);
+        }
+
+        raw = chars.codePoints.empty() && chars.bytes.count() == 1 &&
+              chars.strays.none();
+        if (raw)
+        {
+            single = 0x80;
+            while (!chars.bytes[single])
+                single++;
+            return true;
+        }
+        return chars.single(single);
+    }
+
+    // parse a bracket expression after the opening "["
+    PatternNode *bracket()
+    {
+        CharSet set;
+
+        bool negate = peek() == '^';
+        if (negate)
+            pos++;
+
+        while (peek() != ']')
+        {
+            if (atEnd())
+                throw regex_error(regex_constants::error_brack);
+
+            CharSet chars;
+            unsigned int lo, hi;
+            bool loRaw, hiRaw;
+            bool single = classAtom(chars, lo, loRaw);
+
+            // range, e.g. "a-z" (but not "a-]", where "-" is literal). a range
+            // that ends at a byte is a range of bytes (the part below 80 being
+            // ASCII characters)
+            if (peek() == '-' && pos + 1 < pat.size() && pat[pos + 1] != ']')
+            {
+                pos++;
+                CharSet hiChars;
+                if (!single || !classAtom(hiChars, hi, hiRaw) || lo > hi ||
+                    (loRaw && !hiRaw) || (hiRaw && !loRaw && lo >= 0x80))
+                    throw regex_error(regex_constants::error_range);
+                if (!hiRaw)
+                {
+                    chars.codePoints.add(lo, hi);
+                }
+                else
+                {
+                    if (lo < 0x80)
+                        chars.codePoints.add(lo, 0x7f);
+                    for (unsigned int b = max(lo, 0x80u); b <= hi; b++)
+                        chars.bytes.set(b);
+                }
+            }
+
+            set.add(chars);
+        }
+        pos++; // "]"
+
+        if (negate)
+            set.invert();
+
+        PatternNode *node = new PatternNode(PatternNode::CHARS);
+        node->chars = set;
+        return node;
+    }
+
+    // parse a quantifier (if there is one) and wrap `atom` in a REPEAT node
+    PatternNode *quantifier(PatternNode *atom)
+    {
+        unsigned int min, max;
+        char c = peek();
+
+        if (c == '*')
+            min = 0, max = PatternInfo::unbounded, pos++;
+        else if (c == '+')
+            min = 1, max = PatternInfo::unbounded, pos++;
+        else if (c == '?')
+            min = 0, max = 1, pos++;
+        else if (c == '{')
+        {
+            size_t start = pos++;
+            min = 0;
+            while (!atEnd() && isdigit(peek()))
+                min = min * 10 + (pat[pos++] - '0');
+
+            // as in std::regex, a brace after an atom must start a quantifier
+            if (pos == start + 1)
+            {
+                delete atom;
+                throw regex_error(regex_constants::error_badbrace);
+            }
+            max = min;
+            if (peek() == ',')
+            {
+                pos++;
+                if (isdigit(peek()))
+                {
+                    max = 0;
+                    while (!atEnd() && isdigit(peek()))
+                        max = max * 10 + (pat[pos++] - '0');
+                }
+                else
+                {
+                    max = PatternInfo::unbounded;
+                }
+            }
+            if (atEnd())
+            {
+                delete atom;
+                throw regex_error(regex_constants::error_brace);
+            }
+            if (peek() != '}')
+            {
+                delete atom;
+                throw regex_error(regex_constants::error_badbrace);
+            }
+            pos++;
+            if (min > max)
+            {
+                delete atom;
+                throw regex_error(regex_constants::error_badbrace);
+            }
+        }
+        else
+        {
+            return atom;
+        }
+
+        PatternNode *node = new PatternNode(PatternNode::REPEAT);
+        node->children.push_back(atom);
+        node->min = min;
+        node->max = max;
+        node->greedy = true;
+        if (peek() == '?')
+        {
+            node->greedy = false;
+            pos++;
+        }
+
+        // quantifiers can be stacked by some engines; handle them the same way
+        return quantifier(node);
+    }
+
+    // parse a single term: an assertion, or an atom with optional quantifier
+    PatternNode *term()
+    {
+        size_t start = pos;
+        char c = pat[pos++];
+        PatternNode *atom;
+
+        switch (c)
+        {
+        case '^':
+        case '$':
+            atom = new PatternNode(PatternNode::ASSERTION);
+            atom->text = string(1, c);
+            return atom;
+        case '*':
+        case '+':
+        case '?':
+            throw regex_error(regex_constants::error_badrepeat);
+        case '.':
+            // any character but a line terminator
+            atom = new PatternNode(PatternNode::CHARS);
+            atom->chars.codePoints.add('\n');
+            atom->chars.codePoints.add('\r');
+            atom->chars.invert();
+            break;
+        case '[':
+            atom = bracket();
+            break;
+        case '(':
+        {
+            bool lookahead = false, capturing = true;
+            if (peek() == '?')
+            {
+                char kind = pos + 1 < pat.size() ? pat[pos + 1] : '\0';
+                if (kind != ':' && kind != '=' && kind != '!')
+                    throw regex_error(regex_constants::error_paren);
+                lookahead = kind == '=' || kind == '!';
+                capturing = false;
+                pos += 2;
+            }
+
+            PatternNode *inner = disjunction();
+            if (peek() != ')' || atEnd())
+            {
+                delete inner;
+                throw regex_error(regex_constants::error_paren);
+            }
+            pos++;
+
+            if (lookahead)
+            {
+                // zero-width; the inner pattern only restricts matches
+                atom = new PatternNode(PatternNode::ASSERTION);
+                atom->text = pat.substr(start, 3);
+                atom->children.push_back(inner);
+                return quantifier(atom);
+            }
+
+            atom = new PatternNode(PatternNode::GROUP);
+            atom->capturing = capturing;
+            atom->children.push_back(inner);
+            break;
+        }
+        case '\\':
+        {
+            CharSet chars;
+            PatternNode::Kind kind = PatternNode::CHARS;
+            bool isChars = escape(chars, kind, false);
+
+            atom = new PatternNode(kind);
+            atom->chars = chars;
+            if (!isChars)
+            {
+                atom->text = pat.substr(start, pos - start);
+                if (kind == PatternNode::ASSERTION)
+                    return atom;
+            }
+            break;
+        }
+        default:
+            atom = new PatternNode(PatternNode::CHARS);
+            pos = start;
+            literal(atom->chars);
+            break;
+        }
+
+        return quantifier(atom);
+    }
+
+    // parse a sequence of terms
+    PatternNode *alternative()
+    {
+        PatternNode *node = new PatternNode(PatternNode::CONCAT);
+        try
+        {
+            while (!atEnd() && peek() != '|' && peek() != ')')
+                node->children.push_back(term());
+        }
+        catch (const regex_error &)
+        {
+            delete node;
+            throw;
+        }
+        return node;
+    }
+
+    // parse alternatives separated by "|"
+    PatternNode *disjunction()
+    {
+        PatternNode *node = new PatternNode(PatternNode::ALTERNATE);
+        try
+        {
+            node->children.push_back(alternative());
+            while (peek() == '|' && !atEnd())
+            {
+                pos++;
+                node->children.push_back(alternative());
+            }
+        }
+        catch (const regex_error &)
+        {
+            delete node;
+            throw;
+        }
+        return node;
+    }
+};
+
+// ================
+// Printing helpers
+// ================
+
+/* `toRegex` writes every byte that isn't a letter or "_" as a "\xHH" escape,
+so printed characters never combine with their neighbours (e.g. a digit after
+a backreference) or mean something special in a bracket expression. */
+
+// append a byte to a `std::regex` pattern
+static void appendByte(string &out, unsigned int b)
+{
+    static const char digits[] = "0123456789abcdef";
+    if (b < 128 && (isalpha(b) || b == '_'))
+    {
+        out.push_back((char)b);
+        return;
+    }
+    out += "\\x";
+    out.push_back(digits[b >> 4]);
+    out.push_back(digits[b & 15]);
+}
+
+// append a range of bytes to a `std::regex` pattern
+static void appendByteRange(string &out, const ByteRange &range)
+{
+    if (range.first == range.second)
+    {
+        appendByte(out, range.first);
+        return;
+    }
+    out.push_back('[');
+    appendByte(out, range.first);
+    out.push_back('-');
+    appendByte(out, range.second);
+    out.push_back(']');
+}
+
+// append alternatives matching `sequences[begin, end)` from the range at
+// `depth` on; sequences that share a range at `depth` share its text
+static void appendSequences(string &out,
+                            const vector<vector<ByteRange>> &sequences,
+                            size_t begin, size_t end, size_t depth)
+{
+    for (size_t i = begin; i < end;)
+    {
+        size_t j = i + 1;
+        while (j < end && sequences[j][depth] == sequences[i][depth])
+            j++;
+
+        if (i != begin)
+            out.push_back('|');
+        appendByteRange(out, sequences[i][depth]);
+
+        if (depth + 1 < sequences[i].size())
+        {
+            bool alternatives = false;
+            for (size_t k = i + 1; k < j; k++)
+            {
+                alternatives = alternatives ||
+                               sequences[k][depth + 1] != sequences[i][depth + 1];
+            }
+            if (alternatives)
+                out += "(?:";
+            appendSequences(out, sequences, i, j, depth + 1);
+            if (alternatives)
+                out.push_back(')');
+        }
+
+        i = j;
+    }
+}
+
+// `std::regex` atom matching the UTF-8 encoding of a code point in a set, or
+// else the alternatives in `others`. std::regex's matcher recurses once for
+// each alternative it passes over, on every repetition, so the ASCII
+// characters come first and the rest are nested behind a single alternative
+static string codePointsRegex(const CodePointSet &chars, const string &others)
+{
+    vector<vector<ByteRange>> sequences = chars.utf8Sequences();
+
+    // ASCII characters come first, and are one byte each
+    size_t ascii = 0;
+    while (ascii < sequences.size() && sequences[ascii].size() == 1)
+        ascii++;
+
+    string rest;
+    appendSequences(rest, sequences, ascii, sequences.size(), 0);
+    if (!others.empty())
+        rest += (rest.empty() ? "" : "|") + others;
+
+    string out;
+    if (ascii == 0)
+        return rest.empty() ? "[^\\s\\S]" : "(?:" + rest + ")";
+    if (ascii == 1 && rest.empty())
+    {
+        appendByteRange(out, sequences.front().front());
+        return out;
+    }
+
+    out.push_back('[');
+    for (size_t i = 0; i < ascii; i++)
+    {
+        const ByteRange &range = sequences[i].front();
+        appendByte(out, range.first);
+        if (range.second != range.first)
+        {
+            out.push_back('-');
+            appendByte(out, range.second);
+        }
+    }
+    out.push_back(']');
+    if (!rest.empty())
+        out = "(?:" + out + "|(?:" + rest + "))";
+    return out;
+}
+
+// `std::regex` bracket expression matching a set of bytes
+static string bytesRegex(const bitset<256> &bytes)
+{
+    string out = "[";
+    for (unsigned int b = 0; b < 256; b++)
+    {
+        if (!bytes[b])
+            continue;
+        unsigned int last = b;
+        while (last + 1 < 256 && bytes[last + 1])
+            last++;
+        appendByte(out, b);
+        if (last != b)
+        {
+            out.push_back('-');
+            appendByte(out, last);
+        }
+        b = last;
+    }
+    out.push_back(']');
+    return out;
+}
+
+// `std::regex` alternatives matching a stray byte in a set: a byte that
+// can't start an encoding, or one that can but isn't followed by the rest of
+// one. the byte is matched before the lookahead, so other bytes fail fast
+static string straysRegex(const bitset<256> &strays)
+{
+    CodePointSet nonAscii;
+    nonAscii.add(0x80, CodePointSet::maxCodePoint);
+    vector<vector<ByteRange>> sequences = nonAscii.utf8Sequences();
+
+    string out;
+    bitset<256> others = strays;
+    for (size_t i = 0; i < sequences.size();)
+    {
+        size_t j = i + 1;
+        while (j < sequences.size() && sequences[j][0] == sequences[i][0])
+            j++;
+
+        bitset<256> leads;
+        for (unsigned int b = sequences[i][0].first;
+             b <= sequences[i][0].second; b++)
+        {
+            leads.set(b);
+        }
+        others &= ~leads;
+
+        if ((strays & leads).any())
+        {
+            if (!out.empty())
+                out.push_back('|');
+            out += bytesRegex(strays & leads) + "(?!";
+            appendSequences(out, sequences, i, j, 1);
+            out.push_back(')');
+        }
+        i = j;
+    }
+
+    if (others.any())
+        out = bytesRegex(others) + (out.empty() ? "" : "|" + out);
+    return out;
+}
+
+// `std::regex` pattern matching a character in a set, as a single atom
+static string charsRegex(const CharSet &chars)
+{
+    // the code points are preferred to the bytes, as they are by the automaton
+    string others;
+    if (chars.bytes.any())
+        others = bytesRegex(chars.bytes);
+    if (chars.strays.any())
+        others += (others.empty() ? "" : "|") + straysRegex(chars.strays);
+
+    if (chars.codePoints.empty() && chars.strays.none() && !others.empty())
+        return others;
+    return codePointsRegex(chars.codePoints, others);
+}
+
+// ===============
+// CharSet methods
+// ===============
+
+// add the characters in another set
+void CharSet::add(const CharSet &other)
+{
+    codePoints.add(other.codePoints);
+    bytes |= other.bytes;
+    strays |= other.strays;
+}
+
+// replace the set with the characters that aren't in it
+void CharSet::invert()
+{
+    // a byte that is in the set wherever it appears is in it where it is
+    // stray, so neither is in the inverse
+    bitset<256> high;
+    for (unsigned int b = 0x80; b < 256; b++)
+    {
+        high.set(b);
+    }
+    strays = high & ~(bytes | strays);
+    bytes.reset();
+    codePoints.invert();
+}
+
+// check whether the set is a single code point
+bool CharSet::single(unsigned int &c) const
+{
+    const vector<pair<unsigned int, unsigned int>> &ranges =
+        codePoints.getRanges();
+    if (bytes.any() || strays.any() || ranges.size() != 1 ||
+        ranges.front().first != ranges.front().second)
+        return false;
+
+    c = ranges.front().first;
+    return true;
+}
+
+// get the bytes the characters in the set start with
+bitset<256> CharSet::firstBytes() const
+{
+    return codePoints.firstBytes() | bytes | strays;
+}
+
+// get the length of the longest character in the set
+unsigned int CharSet::maxLength() const
+{
+    unsigned int length = codePoints.maxEncodedLength();
+    if (length == 0 && (bytes.any() || strays.any()))
+        length = 1;
+    return length;
+}
+
+// ===================
+// PatternNode methods
+// ===================
+
+// constructor
+PatternNode::PatternNode(Kind kind)
+    : kind(kind), min(0), max(0), greedy(true), capturing(false) {}
+
+// destructor
+PatternNode::~PatternNode()
+{
+    for (PatternNode *child : children)
+    {
+        delete child;
+    }
+}
+
+// parse a pattern into a syntax tree
+PatternNode *PatternNode::parse(const string &pat)
+{
+    PatternParser parser(pat);
+    PatternNode *root = parser.disjunction();
+
+    // an unbalanced ")" stops the parser early
+    if (!parser.atEnd())
+    {
+        delete root;
+        throw regex_error(regex_constants::error_paren);
+    }
+
+    return root;
+}
+
+// saturating addition for match lengths
+static unsigned int addLengths(unsigned int a, unsigned int b)
+{
+    if (a == PatternInfo::unbounded || b == PatternInfo::unbounded ||
+        a + b < a)
+        return PatternInfo::unbounded;
+    return a + b;
+}
+
+// compute facts about the pattern rooted at this node
+PatternInfo PatternNode::info() const
+{
+    PatternInfo result;
+    result.maxLength = 0;
+    result.nullable = true;
+    result.groups = 0;
+    result.backreferences = false;
+
+    switch (kind)
+    {
+    case EMPTY:
+        break;
+
+    case ASSERTION:
+        // assertions only restrict matches, so treating them as empty gives a
+        // conservative answer; the groups in a lookahead still count
+        if (!children.empty())
+        {
+            PatternInfo c = children.front()->info();
+            result.groups = c.groups;
+            result.backreferences = c.backreferences;
+        }
+        break;
+
+    case CHARS:
+        result.firstBytes = chars.firstBytes();
+        result.maxLength = chars.maxLength();
+        result.nullable = false;
+        break;
+
+    case CONCAT:
+        for (const PatternNode *child : children)
+        {
+            PatternInfo c = child->info();
+            // a child's first bytes can start the match only if everything
+            // before it can be empty
+            if (result.nullable)
+                result.firstBytes |= c.firstBytes;
+            result.nullable = result.nullable && c.nullable;
+            result.maxLength = addLengths(result.maxLength, c.maxLength);
+            result.groups += c.groups;
+            result.backreferences = result.backreferences || c.backreferences;
+        }
+        break;
+
+    case ALTERNATE:
+        result.nullable = false;
+        for (const PatternNode *child : children)
+        {
+            PatternInfo c = child->info();
+            result.firstBytes |= c.firstBytes;
+            result.nullable = result.nullable || c.nullable;
+            if (c.maxLength > result.maxLength)
+                result.maxLength = c.maxLength;
+            result.groups += c.groups;
+            result.backreferences = result.backreferences || c.backreferences;
+        }
+        break;
+
+    case REPEAT:
+    {
+        PatternInfo c = children.front()->info();
+        result.firstBytes = c.firstBytes;
+        result.nullable = min == 0 || c.nullable;
+        result.groups = c.groups;
+        result.backreferences = c.backreferences;
+        if (max == PatternInfo::unbounded && c.maxLength > 0)
+            result.maxLength = PatternInfo::unbounded;
+        else if (c.maxLength != 0 &&
+                 max > PatternInfo::unbounded / c.maxLength)
+            result.maxLength = PatternInfo::unbounded;
+        else
+            result.maxLength = max == PatternInfo::unbounded
+                                   ? 0
+                                   : c.maxLength * max;
+        break;
+    }
+
+    case GROUP:
+        result = children.front()->info();
+        if (capturing)
+            result.groups++;
+        break;
+
+    case OPAQUE:
+        result.firstBytes.set();
+        result.maxLength = PatternInfo::unbounded;
+        result.backreferences = true;
+        break;
+    }
+
+    return result;
+}
+
+// write the pattern rooted at this node as a std::regex pattern
+string PatternNode::toRegex() const
+{
+    string out;
+
+    switch (kind)
+    {
+    case EMPTY:
+        break;
+
+    case ASSERTION:
+        out = text;
+        if (!children.empty())
+            out += children.front()->toRegex() + ")";
+        break;
+
+    case CHARS:
+        out = charsRegex(chars);
+        break;
+
+    case CONCAT:
+        for (const PatternNode *child : children)
+        {
+            if (child->kind == ALTERNATE && child->children.size() > 1)
+                out += "(?:" + child->toRegex() + ")";
+            else
+                out += child->toRegex();
+        }
+        break;
+
+    case ALTERNATE:
+        for (size_t i = 0; i < children.size(); i++)
+        {
+            if (i > 0)
+                out.push_back('|');
+            out += children[i]->toRegex();
+        }
+        break;
+
+    case REPEAT:
+    {
+        // characters and groups are printed as single atoms
+        const PatternNode *child = children.front();
+        if (child->kind == CHARS || child->kind == GROUP)
+            out = child->toRegex();
+        else
+            out = "(?:" + child->toRegex() + ")";
+
+        if (min == 0 && max == PatternInfo::unbounded)
+            out.push_back('*');
+        else if (min == 1 && max == PatternInfo::unbounded)
+            out.push_back('+');
+        else if (min == 0 && max == 1)
+            out.push_back('?');
+        else
+        {
+            out += "{" + to_string(min);
+            if (max == PatternInfo::unbounded)
+                out.push_back(',');
+            else if (max != min)
+                out += "," + to_string(max);
+            out.push_back('}');
+        }
+
+        if (!greedy)
+            out.push_back('?');
+        break;
+    }
+
+    case GROUP:
+        out = (capturing ? "(" : "(?:") + children.front()->toRegex() + ")";
+        break;
+
+    case OPAQUE:
+        out = text;
+        break;
+    }
+
+    return out;
+}
+
+// ===================
+// PatternInfo methods
+// ===================
+
+// analyse a pattern
+PatternInfo PatternInfo::analyse(const string &pat)
+{
+    PatternNode *root;
+    try
+    {
+        root = PatternNode::parse(pat);
+    }
+    catch (const regex_error &)
+    {
+        // the error is reported when the pattern is compiled
+        root = new PatternNode(PatternNode::OPAQUE);
+    }
+
+    PatternInfo result = root->info();
+    delete root;
+    return result;
+}
+
+//
@@ -0,0 +1,178 @@
+/**
+ * @file pattern.hpp
+ *
+ * @brief Declares the `CharSet`, `PatternNode` and `PatternInfo` structs, used
+ * by the lexer to reason about token type patterns without running them.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#ifndef __PATTERN_HPP__
+#define __PATTERN_HPP__
+
+#include "unicode.hpp"
+
+#include <bitset>
+#include <string>
+#include <vector>
+using namespace std;
+
+/// @brief Static facts about a pattern that hold for every non-empty match.
+struct PatternInfo
+{
+    /// @brief Value of `maxLength` for patterns whose matches can be
+    /// arbitrarily long.
+    static const unsigned int unbounded = ~0u;
+
+    /// @brief The bytes that a non-empty match of the pattern can start with.
+    bitset<256> firstBytes;
+
+    /// @brief Upper bound on the length of a match of the pattern, or
+    /// `unbounded`.
+    unsigned int maxLength;
+
+    /// @brief Whether the pattern can match the empty string.
+    bool nullable;
+
+    /// @brief Number of capture groups in the pattern.
+    unsigned int groups;
+
+    /// @brief Whether the pattern contains backreferences (or other syntax the
+    /// analyser doesn't understand), which need capture groups to match.
+    bool backreferences;
+
+    /// @brief Analyse a pattern (see `PatternNode::parse`).
+    /// @param pat The pattern to analyse.
+    /// @return Facts about the pattern. Syntax the analyser doesn't understand
+    /// (including invalid patterns, which are reported when the pattern is
+    /// compiled) is approximated conservatively, so `firstBytes` and
+    /// `maxLength` may be larger than necessary but are never too small.
+    static PatternInfo analyse(const string &pat);
+};
+
+/// @brief A set of characters in a pattern. Patterns match UTF-8 text, but
+/// keep the byte semantics of `std::regex` for input that isn't valid UTF-8:
+/// `\xHH` escapes from 80 up (and bytes in the pattern that aren't valid
+/// UTF-8) match that byte, and negated sets (including `.`) match bytes that
+/// don't start a valid encoding.
+struct CharSet
+{
+    /// @brief Code points whose UTF-8 encodings are in the set.
+    CodePointSet codePoints;
+
+    /// @brief Bytes from 80 up that are in the set wherever they appear.
+    bitset<256> bytes;
+
+    /// @brief Bytes from 80 up that are in the set where they don't start a
+    /// valid UTF-8 encoding ("stray" bytes, e.g. Latin-1 text).
+    bitset<256> strays;
+
+    /// @brief Add the characters in another set to this set.
+    /// @param other The other set.
+    void add(const CharSet &other);
+
+    /// @brief Replace the set with the characters that aren't in it: the
+    /// code points that aren't in it, and the stray bytes that aren't in
+    /// `bytes` or `strays`.
+    void invert();
+
+    /// @brief Indicates whether the set is a single code point, and if so
+    /// which.
+    /// @param c On success, the code point.
+    /// @return `true` if the set is a single code point, else `false`.
+    bool single(unsigned int &c) const;
+
+    /// @brief Get the bytes that the characters in the set start with.
+    /// @return The first bytes.
+    bitset<256> firstBytes() const;
+
+    /// @brief Get the length in bytes of the longest character in the set.
+    /// @return The length, from 1 to 4, or 0 if the set is empty.
+    unsigned int maxLength() const;
+};
+
+/// @brief A node in the syntax tree of a pattern.
+struct PatternNode
+{
+    /// @brief The kinds of pattern nodes.
+    enum Kind
+    {
+        /// @brief Matches the empty string.
+        EMPTY,
+        /// @brief Zero-width assertion (`^`, `$`, `\b`, ...), written as
+        /// `text`. The body of a lookahead is kept as the only child.
+        ASSERTION,
+        /// @brief Matches a single character from `chars`.
+        CHARS,
+        /// @brief Matches its children one after the other.
+        CONCAT,
+        /// @brief Matches any one of its children, preferring earlier ones.
+        ALTERNATE,
+        /// @brief Matches its only child between `min` and `max` times.
+        REPEAT,
+        /// @brief Matches its only child; `capturing` says whether it is a
+        /// capture group.
+        GROUP,
+        /// @brief Syntax that can't be reasoned about statically (e.g.
+        /// backreferences), written as `text`; may match anything.
+        OPAQUE
+    };
+
+    /// @brief The kind of this node.
+    Kind kind;
+
+    /// @brief Characters matched by a `CHARS` node.
+    CharSet chars;
+
+    /// @brief The syntax of an `ASSERTION` or `OPAQUE` node (for a lookahead,
+    /// up to the start of its body).
+    string text;
+
+    /// @brief Child nodes of a `CONCAT`, `ALTERNATE`, `REPEAT`, `GROUP` or
+    /// `ASSERTION` node.
+    vector<PatternNode *> children;
+
+    /// @brief Minimum repetitions of a `REPEAT` node.
+    unsigned int min;
+
+    /// @brief Maximum repetitions of a `REPEAT` node, or
+    /// `PatternInfo::unbounded`.
+    unsigned int max;
+
+    /// @brief Whether a `REPEAT` node prefers more repetitions to fewer.
+    bool greedy;
+
+    /// @brief Whether a `GROUP` node is a capture group.
+    bool capturing;
+
+    /// @brief Constructor.
+    /// @param kind The kind of node.
+    PatternNode(Kind kind);
+
+    /// @brief Destructor; frees the child nodes.
+    ~PatternNode();
+
+    /// @brief Parse a pattern into a syntax tree. Patterns are ECMAScript
+    /// regular expressions, as accepted by `std::regex`, over UTF-8 text:
+    /// characters (including those in bracket expressions and `\uHHHH`
+    /// escapes) are Unicode code points, and `\p{...}` and `\P{...}` match the
+    /// characters in and not in a Unicode general category (see
+    /// `CodePointSet::category`). Input that isn't valid UTF-8 is matched a
+    /// byte at a time (see `CharSet`). Throws a `regex_error` if the pattern
+    /// is invalid.
+    /// @param pat The pattern to parse.
+    /// @return The root of the syntax tree, owned by the caller.
+    static PatternNode *parse(const string &pat);
+
+    /// @brief Compute `PatternInfo` for the pattern rooted at this node.
+    /// @return Facts about the pattern rooted at this node.
+    PatternInfo info() const;
+
+    /// @brief Write the pattern rooted at this node as a `std::regex` pattern
+    /// that matches bytes the way this pattern matches UTF-8 text, with the
+    /// same capture groups.
+    /// @return The `std::regex` pattern.
+    string toRegex() const;
+};
+
+#endif
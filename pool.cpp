@@ -0,0 +1,69 @@
+/**
+ * @file pool.cpp
+ *
+ * @brief Implements methods for the `LexerPool` class.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#include "pool.hpp"
+
+// =================
+// LexerPool methods
+// =================
+
+// constructor
+LexerPool::LexerPool(function<void(Lexer *)> setup) : setup(setup) {}
+
+// take a lexer from the pool
+Lexer *LexerPool::acquire()
+{
+    {
+        lock_guard<mutex> guard(lock);
+        if (!idle.empty())
+        {
+            Lexer *lexer = idle.back();
+            idle.pop_back();
+            return lexer;
+        }
+    }
+
+    // set up the new lexer without holding the lock, since it may take a while
+    Lexer *lexer = new Lexer();
+    try
+    {
+        setup(lexer);
+    }
+    catch (...)
+    {
+        delete lexer;
+        throw;
+    }
+
+    lock_guard<mutex> guard(lock);
+    lexers.push_back(lexer);
+
+    // make room in the idle list now, so that releasing never allocates
+    idle.reserve(lexers.size());
+    return lexer;
+}
+
+// give a lexer back to the pool
+void LexerPool::release(Lexer *lexer)
+{
+    lexer->reset();
+
+    lock_guard<mutex> guard(lock);
+    idle.push_back(lexer);
+}
+
+// destructor
+LexerPool::~LexerPool()
+{
+    for (Lexer *lexer : lexers)
+    {
+        delete lexer;
+    }
+}
+
+//
@@ -0,0 +1,57 @@
+/**
+ * @file pool.hpp
+ *
+ * @brief Declares the `LexerPool` class.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#ifndef __POOL_HPP__
+#define __POOL_HPP__
+
+#include "lexer.hpp"
+
+#include <functional>
+#include <mutex>
+#include <vector>
+using namespace std;
+
+/// @brief A thread-safe pool of lexers with the same token types, for
+/// programs that lex many unrelated strings (e.g. one per request). Lexers
+/// are reset rather than destroyed when they are released, so they keep their
+/// compiled patterns and storage warm for the next user.
+class LexerPool
+{
+private:
+    /// @brief Function to set up new lexers (e.g. register token types).
+    const function<void(Lexer *)> setup;
+
+    /// @brief Every lexer created by the pool.
+    vector<Lexer *> lexers;
+
+    /// @brief Lexers that are not in use.
+    vector<Lexer *> idle;
+
+    /// @brief Guards `lexers` and `idle`.
+    mutex lock;
+
+public:
+    /// @brief Constructor.
+    /// @param setup Function to set up new lexers (e.g. register token types
+    /// or load tables).
+    LexerPool(function<void(Lexer *)> setup);
+
+    /// @brief Take a lexer from the pool, creating one if none are idle.
+    /// @return A lexer, which must be given back with `release`.
+    Lexer *acquire();
+
+    /// @brief Give a lexer back to the pool. The lexer is reset, which frees
+    /// its tokens, so they must not be used afterwards.
+    /// @param lexer A lexer returned by `acquire`.
+    void release(Lexer *lexer);
+
+    /// @brief Destructor; frees every lexer created by the pool.
+    ~LexerPool();
+};
+
+#endif
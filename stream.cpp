@@ -0,0 +1,205 @@
+/**
+ * @file stream.cpp
+ *
+ * @brief Implements methods for the `TokenStream` class and the
+ * `TokenStreamQueue` class.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#include "stream.hpp"
+
+#include <sstream>
+#include <stdexcept>
+using namespace std;
+
+// ===================
+// TokenStream methods
+// ===================
+
+// append a variable-length integer
+void TokenStream::putVarint(size_t value)
+{
+    while (value >= 0x80)
+    {
+        data.push_back((unsigned char)(value | 0x80));
+        value >>= 7;
+    }
+    data.push_back((unsigned char)value);
+}
+
+// read a variable-length integer
+static size_t getVarint(const unsigned char *&p)
+{
+    size_t value = 0;
+    for (unsigned int shift = 0;; shift += 7)
+    {
+        unsigned char byte = *p++;
+        value |= (size_t)(byte & 0x7f) << shift;
+        if (byte < 0x80)
+            return value;
+    }
+}
+
+// decode a token
+void TokenStream::decode(const unsigned char *&p, size_t &end,
+                         size_t &source, TokenSpan &span) const
+{
+    size_t header = getVarint(p);
+    span.tokenType = types[header >> 2];
+    if (header & 2)
+    {
+        source += getVarint(p);
+        end = 0;
+    }
+    span.source = source;
+    span.position = end;
+    if (header & 1)
+        span.position += getVarint(p);
+    span.length = getVarint(p);
+    end = span.position + span.length;
+}
+
+// start a new source
+void TokenStream::startSource()
+{
+    sources++;
+    end = 0;
+}
+
+// append a token
+void TokenStream::append(const TokenType *tokenType, size_t position,
+                         size_t length)
+{
+    if (position < end)
+    {
+        ostringstream ss;
+        ss << "Token Stream Error: token at position " << position;
+        ss << " starts before the end of the previous token (" << end << ")";
+        throw runtime_error(ss.str());
+    }
+
+    // give new token types the next id
+    auto found = typeIds.find(tokenType);
+    unsigned int id;
+    if (found != typeIds.end())
+    {
+        id = found->second;
+    }
+    else
+    {
+        id = types.size();
+        types.push_back(tokenType);
+        typeIds[tokenType] = id;
+    }
+
+    if (count % blockSize == 0)
+        blocks.push_back(Block{data.size(), end, lastSource});
+
+    // tokens usually start where the previous one ended, in the same source,
+    // so the gap and the change of source are only stored if there are any
+    if (sources == 0)
+        sources = 1;
+    size_t skipped = sources - 1 - lastSource;
+    size_t gap = position - end;
+    putVarint((size_t)id << 2 | (skipped != 0) << 1 | (gap != 0));
+    if (skipped != 0)
+        putVarint(skipped);
+    if (gap != 0)
+        putVarint(gap);
+    putVarint(length);
+
+    count++;
+    end = position + length;
+    lastSource = sources - 1;
+}
+
+// number of tokens
+size_t TokenStream::size() const
+{
+    return count;
+}
+
+// get a token
+TokenSpan TokenStream::at(size_t index) const
+{
+    if (index >= count)
+        throw out_of_range("Token Stream Error: token index out of range");
+
+    return *TokenStreamQueue(this, index).getHead();
+}
+
+// make a queue of the tokens from a given token on
+TokenStreamQueue TokenStream::getTokenQueue(size_t index) const
+{
+    return TokenStreamQueue(this, index);
+}
+
+// remove every token
+void TokenStream::clear()
+{
+    data.clear();
+    blocks.clear();
+    types.clear();
+    typeIds.clear();
+    count = 0;
+    end = 0;
+    sources = 0;
+    lastSource = 0;
+}
+
+// estimated memory used by the stream
+size_t TokenStream::memory() const
+{
+    // hash table nodes hold a key, a value and a link, plus a bucket pointer
+    return sizeof(TokenStream) + data.capacity() +
+           blocks.capacity() * sizeof(Block) +
+           types.capacity() * sizeof(const TokenType *) +
+           typeIds.size() * (sizeof(const TokenType *) + sizeof(unsigned int) +
+                             2 * sizeof(void *)) +
+           typeIds.bucket_count() * sizeof(void *);
+}
+
+// ========================
+// TokenStreamQueue methods
+// ========================
+
+// constructor
+TokenStreamQueue::TokenStreamQueue(const TokenStream *stream, size_t index)
+    : stream(stream), next(nullptr), index(index)
+{
+    if (index >= stream->count)
+        return;
+
+    // decode from the start of the first token's block
+    const TokenStream::Block &block =
+        stream->blocks[index / TokenStream::blockSize];
+    next = stream->data.data() + block.offset;
+    size_t end = block.end, source = block.source;
+    for (size_t i = index - index % TokenStream::blockSize; i <= index; i++)
+    {
+        stream->decode(next, end, source, head);
+    }
+}
+
+// get the first token
+const TokenSpan *TokenStreamQueue::getHead() const
+{
+    if (index >= stream->count)
+        return nullptr;
+
+    return &head;
+}
+
+// drop the first token and return the new first token
+const TokenSpan *TokenStreamQueue::dropHead()
+{
+    if (index >= stream->count || ++index >= stream->count)
+        return nullptr;
+
+    size_t end = head.position + head.length, source = head.source;
+    stream->decode(next, end, source, head);
+    return &head;
+}
+
+//
@@ -0,0 +1,194 @@
+/**
+ * @file stream.hpp
+ *
+ * @brief Declares the `TokenSpan` struct, the `TokenStream` class and the
+ * `TokenStreamQueue` class, used to store the tokens of large inputs
+ * compactly.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#ifndef __STREAM_HPP__
+#define __STREAM_HPP__
+
+#include "token.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+using namespace std;
+
+/// @brief The type and extent of a token in a `TokenStream`.
+struct TokenSpan
+{
+    /// @brief The type of the token.
+    const TokenType *tokenType;
+
+    /// @brief Index of the source (the string the token was lexed from) in
+    /// the stream, counting from 0 (see `TokenStream::startSource`).
+    size_t source;
+
+    /// @brief Position of the start of the token in the string it was lexed
+    /// from.
+    size_t position;
+
+    /// @brief Length of the token.
+    size_t length;
+};
+
+class TokenStreamQueue;
+
+/// @brief A compact, append-only sequence of tokens, each stored as its type
+/// and extent rather than as a `BaseToken`. Tokens take a few bytes each:
+/// types are stored as small integer ids, and extents as variable-length
+/// integers relative to the end of the previous token, which is left out
+/// altogether when a token starts where the previous one ended. Every
+/// `blockSize` tokens, the stream records where the next token is stored, so
+/// any token can be found without decoding the whole stream. Tokens from
+/// several strings can be appended, each string starting a new source.
+class TokenStream
+{
+    friend class TokenStreamQueue;
+
+private:
+    /// @brief Where a block of `blockSize` tokens starts.
+    struct Block
+    {
+        /// @brief Position in `data` of the first token of the block.
+        size_t offset;
+
+        /// @brief End of the token before the block (0 for the first block).
+        size_t end;
+
+        /// @brief Source of the token before the block (0 for the first
+        /// block).
+        size_t source;
+    };
+
+    /// @brief Number of tokens per block.
+    static const size_t blockSize = 128;
+
+    /// @brief The encoded tokens. Each token is a variable-length integer
+    /// holding its type id shifted left by two, with the low bit set if there
+    /// is a gap between the previous token and this one, and the next bit set
+    /// if the token is from a later source than the previous one; then, if it
+    /// is, the number of sources on from the previous token's; then, if there
+    /// is a gap, its length (from the start of the source, for the first
+    /// token of a source); then the length of the token. Variable-length
+    /// integers are stored 7 bits per byte, least significant first, with the
+    /// high bit set on every byte but the last.
+    vector<unsigned char> data;
+
+    /// @brief Where each block starts.
+    vector<Block> blocks;
+
+    /// @brief The token types in the stream, indexed by id.
+    vector<const TokenType *> types;
+
+    /// @brief The id of each token type in the stream.
+    unordered_map<const TokenType *, unsigned int> typeIds;
+
+    /// @brief Number of tokens in the stream.
+    size_t count = 0;
+
+    /// @brief End of the last token in the stream, or 0 if no token has been
+    /// appended since the current source was started.
+    size_t end = 0;
+
+    /// @brief Number of sources started, including the first, which is
+    /// started by appending a token if not by `startSource`.
+    size_t sources = 0;
+
+    /// @brief Source of the last token in the stream.
+    size_t lastSource = 0;
+
+    /// @brief Append a variable-length integer to `data`.
+    /// @param value The integer.
+    void putVarint(size_t value);
+
+    /// @brief Decode a token.
+    /// @param p Where the token is stored; on return, where the next token is
+    /// stored.
+    /// @param end End of the previous token; on return, end of this token.
+    /// @param source Source of the previous token; on return, source of this
+    /// token.
+    /// @param span On return, the token.
+    void decode(const unsigned char *&p, size_t &end, size_t &source,
+                TokenSpan &span) const;
+
+public:
+    /// @brief Start a new source: the tokens appended after this are from
+    /// another string, so their positions start again from 0. `Lexer::lex`
+    /// starts a source for each string it lexes into the stream.
+    void startSource();
+
+    /// @brief Append a token to the stream, from the current source. Tokens
+    /// must be appended in order, and can't overlap; throws a runtime error if
+    /// the token starts before the end of the last token from the same
+    /// source.
+    /// @param tokenType The type of the token.
+    /// @param position Position of the start of the token.
+    /// @param length Length of the token.
+    void append(const TokenType *tokenType, size_t position, size_t length);
+
+    /// @brief Get the number of tokens in the stream.
+    /// @return The number of tokens.
+    size_t size() const;
+
+    /// @brief Get a token. Throws an out of range error if there is no such
+    /// token.
+    /// @param index Index of the token.
+    /// @return The token.
+    TokenSpan at(size_t index) const;
+
+    /// @brief Make a queue that goes through the tokens in order, starting
+    /// from a given token.
+    /// @param index Index of the first token in the queue.
+    /// @return The queue.
+    TokenStreamQueue getTokenQueue(size_t index = 0) const;
+
+    /// @brief Remove every token from the stream, keeping the memory allocated
+    /// for them for reuse.
+    void clear();
+
+    /// @brief Get the estimated memory used by the stream.
+    /// @return The memory used in bytes.
+    size_t memory() const;
+};
+
+/// @brief Goes through the tokens in a `TokenStream` in order, with the same
+/// `getHead` and `dropHead` methods as `TokenQueue`. Unlike a `TokenQueue`,
+/// dropping a token doesn't remove it from the stream, and appending tokens to
+/// the stream invalidates the queue.
+class TokenStreamQueue
+{
+private:
+    /// @brief The stream.
+    const TokenStream *stream;
+
+    /// @brief Where the token after the head is stored.
+    const unsigned char *next;
+
+    /// @brief Index of the head in the stream.
+    size_t index;
+
+    /// @brief The head, if `index` is less than the number of tokens.
+    TokenSpan head;
+
+public:
+    /// @brief Constructor.
+    /// @param stream The stream.
+    /// @param index Index of the first token in the queue.
+    TokenStreamQueue(const TokenStream *stream, size_t index);
+
+    /// @brief Get the first token in the queue.
+    /// @return The first token, or `nullptr` if the queue is empty.
+    const TokenSpan *getHead() const;
+
+    /// @brief Remove the first token from the queue and return the new first
+    /// token.
+    /// @return The new first token, or `nullptr` if the queue is empty.
+    const TokenSpan *dropHead();
+};
+
+#endif
@@ -8,9 +8,13 @@
 
 #include "token.hpp"
 #include "lexer.hpp"
+#include "pool.hpp"
 
 #include <iostream>
 #include <sstream>
+#include <fstream>
+#include <cstdio>
+#include <thread>
 #include <cassert>
 using namespace std;
 
@@ -84,6 +88,174 @@ public:
         TokenType("whitespace", "[ \t\n]+", lex);
 };
 
+// minus operator token
+class MinusToken : public BaseToken
+{
+public:
+    // lex method
+    static const BaseToken *lex(const smatch *match)
+    {
+        return new MinusToken();
+    }
+
+    // token type getter
+    const TokenType *getTokenType() const override
+    {
+        return &tokenType;
+    }
+
+    // token type
+    inline static const TokenType tokenType = TokenType("minus", "-", lex);
+};
+
+// "if" keyword token
+class IfToken : public BaseToken
+{
+public:
+    // lex method
+    static const BaseToken *lex(const smatch *match)
+    {
+        return new IfToken();
+    }
+
+    // token type getter
+    const TokenType *getTokenType() const override
+    {
+        return &tokenType;
+    }
+
+    // token type
+    inline static const TokenType tokenType = TokenType("if", "if", lex);
+};
+
+// identifier token
+class IdentToken : public BaseToken
+{
+public:
+    const string name;
+
+    IdentToken(string name) : name(name) {}
+
+    // lex method
+    static const BaseToken *lex(const smatch *match)
+    {
+        return new IdentToken(match->str(0));
+    }
+
+    // token type getter
+    const TokenType *getTokenType() const override
+    {
+        return &tokenType;
+    }
+
+    // token type
+    inline static const TokenType tokenType =
+        TokenType("ident", "[a-z_][a-z0-9_]*", lex);
+};
+
+// assignment token, e.g. "x=12"
+class AssignToken : public BaseToken
+{
+public:
+    const string name;
+    const unsigned int val;
+
+    AssignToken(string name, unsigned int val) : name(name), val(val) {}
+
+    // lex method (uses the capture groups)
+    static const BaseToken *lex(const smatch *match)
+    {
+        return new AssignToken(match->str(1), stoul(match->str(2)));
+    }
+
+    // token type getter
+    const TokenType *getTokenType() const override
+    {
+        return &tokenType;
+    }
+
+    // token type
+    inline static const TokenType tokenType =
+        TokenType("assign", "([a-z]+)=([0-9]+)", lex);
+};
+
+// word token, e.g. "größe" or "変数2"
+class WordToken : public BaseToken
+{
+public:
+    const string word;
+
+    WordToken(string word) : word(word) {}
+
+    // lex method
+    static const BaseToken *lex(const smatch *match)
+    {
+        return new WordToken(match->str(0));
+    }
+
+    // token type getter
+    const TokenType *getTokenType() const override
+    {
+        return &tokenType;
+    }
+
+    // token type
+    inline static const TokenType tokenType =
+        TokenType("word", "[\\p{L}_][\\p{L}\\p{Nd}_]*", lex);
+};
+
+// quoted text token, e.g. "«naïve café»"
+class QuotedToken : public BaseToken
+{
+public:
+    const string text;
+
+    QuotedToken(string text) : text(text) {}
+
+    // lex method (uses the capture group)
+    static const BaseToken *lex(const smatch *match)
+    {
+        return new QuotedToken(match->str(1));
+    }
+
+    // token type getter
+    const TokenType *getTokenType() const override
+    {
+        return &tokenType;
+    }
+
+    // token type
+    inline static const TokenType tokenType =
+        TokenType("quoted", "«([^»]*)»", lex);
+};
+
+// token that records the input after it, e.g. "ab" in "x ab" is followed by
+// nothing, and "x" by " ab"
+class RestToken : public BaseToken
+{
+public:
+    const string rest;
+    const long position;
+
+    RestToken(string rest, long position) : rest(rest), position(position) {}
+
+    // lex method (uses the suffix and position of the match)
+    static const BaseToken *lex(const smatch *match)
+    {
+        return new RestToken(match->suffix().str(), match->position(0));
+    }
+
+    // token type getter
+    const TokenType *getTokenType() const override
+    {
+        return &tokenType;
+    }
+
+    // token type
+    inline static const TokenType tokenType =
+        TokenType("rest", "[a-z]+", lex);
+};
+
 // help debug the lexer
 void lexerDebug()
 {
@@ -92,6 +264,7 @@ void lexerDebug()
     lexer->registerTokenType(&WhitespaceToken::tokenType);
     lexer->registerTokenType(&UIntToken::tokenType);
     lexer->registerTokenType(&IntToken::tokenType);
+    lexer->setRecordCandidates(true);
 
     // program string
     string s = "12 -24 65 -2 44 -67";
@@ -119,6 +292,7 @@ void lexerTest1()
     lexer->registerTokenType(&WhitespaceToken::tokenType);
     lexer->registerTokenType(&UIntToken::tokenType);
     lexer->registerTokenType(&IntToken::tokenType);
+    lexer->setRecordCandidates(true);
 
     // program string
     string s = "12 -24 65 -2 44 -67";
@@ -201,6 +375,708 @@ void lexerTest2()
     delete lexer;
 }
 
+// check that token types kept more often are not preferred over token types
+// registered earlier when two candidates have the same length
+void lexerTest3()
+{
+    // create a lexer and register token types (the keyword before the
+    // identifier, so "if" should always be lexed as a keyword)
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&IfToken::tokenType);
+    lexer->registerTokenType(&IdentToken::tokenType);
+    lexer->setRecordCandidates(true);
+
+    // lex plenty of identifiers so that the lexer starts trying the
+    // identifier token type first
+    string s;
+    for (int i = 0; i < 2000; i++)
+    {
+        s += "x ";
+    }
+    s += "if iffy i";
+    lexer->lex(s);
+
+    // check the last few candidates
+    string candidatesString = lexer->candidatesString();
+    istringstream ss = istringstream(candidatesString);
+    string line, last[5];
+    while (getline(ss, line))
+    {
+        for (int i = 0; i < 4; i++)
+            last[i] = last[i + 1];
+        last[4] = line;
+    }
+
+    assert(last[0] == "if candidate: \"if\"");
+    assert(last[1] == "whitespace candidate: \" \"");
+    assert(last[2] == "ident candidate: \"iffy\"");
+    assert(last[3] == "whitespace candidate: \" \"");
+    assert(last[4] == "ident candidate: \"i\"");
+
+    // cleanup
+    delete lexer;
+}
+
+// check that unmatched input at the end of the program is reported
+void lexerTest4()
+{
+    // create a lexer and register token types (note: don't register the
+    // whitespace token)
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&UIntToken::tokenType);
+
+    // program string with trailing spaces
+    string s = "12  ";
+
+    bool behavedAsExpected;
+    try
+    {
+        lexer->lex(s);
+        behavedAsExpected = false;
+    }
+    catch (runtime_error &e)
+    {
+        behavedAsExpected =
+            string(e.what()) == "Lexer Error: unmatched input \"  \" at "
+                                "position 2";
+    }
+
+    if (!behavedAsExpected)
+    {
+        throw runtime_error("Didn't report trailing unmatched input!");
+    }
+
+    delete lexer;
+}
+
+// check that capture groups are available to the lex functions of token
+// types that have them
+void lexerTest5()
+{
+    // create a lexer and register token types
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&AssignToken::tokenType);
+    lexer->registerTokenType(&IdentToken::tokenType);
+
+    // program string
+    string s = "abc x=12 yz=3";
+
+    // lex program string
+    lexer->lex(s);
+
+    // check output
+    TokenQueue tq = lexer->getTokenQueue();
+    const IdentToken *ident = dynamic_cast<const IdentToken *>(tq.getHead());
+    assert(ident != nullptr && ident->name == "abc");
+    tq.dropHead();
+    const AssignToken *assign =
+        dynamic_cast<const AssignToken *>(tq.dropHead());
+    assert(assign != nullptr && assign->name == "x" && assign->val == 12);
+    tq.dropHead();
+    assign = dynamic_cast<const AssignToken *>(tq.dropHead());
+    assert(assign != nullptr && assign->name == "yz" && assign->val == 3);
+    assert(tq.dropHead() == nullptr);
+
+    // cleanup
+    delete lexer;
+}
+
+// check that the token types expected by a parser decide between "-" as an
+// operator and "-" as part of a negative number
+void lexerTest6()
+{
+    // create a lexer and register token types
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&MinusToken::tokenType);
+    lexer->registerTokenType(&IntToken::tokenType);
+
+    TokenTypeSet operand = lexer->tokenTypeSet({&IntToken::tokenType});
+    TokenTypeSet op = lexer->tokenTypeSet({&MinusToken::tokenType});
+    TokenTypeSet space = lexer->tokenTypeSet({&WhitespaceToken::tokenType});
+
+    // "5 -2" as a subtraction: operand, space, operator, operand
+    lexer->open("5 -2");
+    const IntToken *a = dynamic_cast<const IntToken *>(lexer->next(operand));
+    assert(a != nullptr && a->val == 5);
+    assert(lexer->next(space)->toString() == "whitespace token");
+    assert(lexer->next(op)->toString() == "minus token");
+    const IntToken *b = dynamic_cast<const IntToken *>(lexer->next(operand));
+    assert(b != nullptr && b->val == 2);
+    assert(lexer->next(operand) == nullptr);
+    assert(lexer->atEnd());
+
+    // when the expected token types don't match, nothing is consumed, so
+    // other token types can be tried
+    lexer->open("-5");
+    assert(lexer->next(space) == nullptr);
+    assert(!lexer->atEnd());
+    assert(lexer->next(op)->toString() == "minus token");
+    b = dynamic_cast<const IntToken *>(lexer->next(operand));
+    assert(b != nullptr && b->val == 5);
+
+    // sets can be built at runtime, and a default set has every token type
+    vector<const TokenType *> types = {&MinusToken::tokenType};
+    TokenTypeSet built = lexer->tokenTypeSet(types);
+    lexer->open("--2");
+    assert(lexer->next(built)->toString() == "minus token");
+    b = dynamic_cast<const IntToken *>(lexer->next(TokenTypeSet()));
+    assert(b != nullptr && b->val == -2);
+
+    // sets can't be used with another lexer
+    Lexer *other = new Lexer();
+    other->registerTokenType(&MinusToken::tokenType);
+    other->open("-");
+    bool behavedAsExpected = false;
+    try
+    {
+        other->next(op);
+    }
+    catch (runtime_error &e)
+    {
+        behavedAsExpected = true;
+    }
+    assert(behavedAsExpected);
+    delete other;
+
+    // without expected token types the longest match wins
+    lexer->open("5 -2");
+    assert(lexer->next()->toString() == "int token");
+    assert(lexer->next()->toString() == "whitespace token");
+    b = dynamic_cast<const IntToken *>(lexer->next());
+    assert(b != nullptr && b->val == -2);
+    assert(lexer->next() == nullptr);
+
+    // cleanup
+    delete lexer;
+}
+
+// check that tables saved by one lexer can be loaded by another, and that
+// stale tables are not used
+void lexerTest7()
+{
+    // create a lexer, register token types and lex a program so that the
+    // tables include kept counts
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&IfToken::tokenType);
+    lexer->registerTokenType(&IdentToken::tokenType);
+    lexer->setRecordCandidates(true);
+    lexer->lex("x y z if iffy");
+    string tables = lexer->saveTables();
+    string expected = lexer->candidatesString();
+    delete lexer;
+
+    // a lexer without the tables hasn't compiled any patterns yet
+    lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&IfToken::tokenType);
+    lexer->registerTokenType(&IdentToken::tokenType);
+    size_t uncompiled = lexer->memoryUsage().matcher;
+    delete lexer;
+
+    // a lexer with the same token types uses the tables (so starts with the
+    // compiled patterns), and lexes the same
+    lexer = new Lexer();
+    assert(lexer->loadTables(tables.data(), tables.size()));
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&IfToken::tokenType);
+    lexer->registerTokenType(&IdentToken::tokenType);
+    assert(lexer->usedTables());
+    assert(lexer->memoryUsage().matcher > uncompiled);
+    lexer->setRecordCandidates(true);
+    lexer->lex("x y z if iffy");
+    assert(lexer->candidatesString() == expected);
+    delete lexer;
+
+    // tables can be loaded from a file
+    string path = "objlrl_tables_test.bin";
+    ofstream out(path, ios::binary);
+    out << tables;
+    out.close();
+    lexer = new Lexer();
+    assert(lexer->loadTablesFile(path));
+    remove(path.c_str());
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&IfToken::tokenType);
+    lexer->registerTokenType(&IdentToken::tokenType);
+    assert(lexer->usedTables());
+    lexer->setRecordCandidates(true);
+    lexer->lex("x y z if iffy");
+    assert(lexer->candidatesString() == expected);
+    assert(!lexer->loadTablesFile(path));
+    delete lexer;
+
+    // the header declares the tables and their size
+    ostringstream header;
+    Lexer::writeTablesHeader(header, tables, "testTables");
+    assert(header.str().find("static const char testTables[] = {") !=
+           string::npos);
+    assert(header.str().find("testTablesSize = " + to_string(tables.size()) +
+                             ";") != string::npos);
+
+    // a lexer with different token types ignores the tables
+    lexer = new Lexer();
+    assert(lexer->loadTables(tables.data(), tables.size()));
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&UIntToken::tokenType);
+    assert(!lexer->usedTables());
+    lexer->lex("12 3");
+    assert(lexer->getTokenQueue().getHead()->toString() == "uint token");
+    delete lexer;
+
+    // malformed tables are rejected
+    lexer = new Lexer();
+    assert(!lexer->loadTables(tables.data(), tables.size() - 1));
+    assert(!lexer->loadTables("objlrl", 6));
+    delete lexer;
+}
+
+// check that a reset lexer forgets the previous string but can still lex
+void lexerTest8()
+{
+    // create a lexer and register token types
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&UIntToken::tokenType);
+    lexer->registerTokenType(&IntToken::tokenType);
+    lexer->setRecordCandidates(true);
+
+    // lex, reset, then lex something else
+    lexer->lex("12 -24 65");
+    lexer->reset();
+    assert(lexer->candidatesString() == "");
+    assert(lexer->getTokenQueue().getHead() == nullptr);
+    lexer->lex("-3");
+    assert(lexer->candidatesString() == "int candidate: \"-3\"\n");
+
+    // cleanup
+    delete lexer;
+}
+
+// check memory accounting and the memory budget
+void lexerTest9()
+{
+    // create a lexer and register token types
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&UIntToken::tokenType);
+
+    // the peak includes the copy of the string and the tokens
+    string s;
+    for (int i = 0; i < 100; i++)
+    {
+        s += "1 ";
+    }
+    lexer->lex(s);
+    LexerMemory memory = lexer->memoryUsage();
+    assert(memory.sources >= s.size());
+    assert(memory.tokens >= 200 * sizeof(BaseToken));
+    assert(memory.matcher > 0);
+    assert(lexer->peakMemoryUsage() >= memory.total());
+
+    // candidates aren't recorded unless asked for
+    assert(memory.candidates < 200 * sizeof(CandidateToken));
+    assert(lexer->candidatesString() == "");
+
+    // input too big for the budget is rejected before it is copied
+    lexer->reset();
+    lexer->setMemoryBudget(lexer->memoryUsage().total() + 1000);
+    string big(10000, ' ');
+    bool behavedAsExpected = false;
+    try
+    {
+        lexer->lex(big);
+    }
+    catch (LexerMemoryError &e)
+    {
+        behavedAsExpected = true;
+    }
+    assert(behavedAsExpected);
+    assert(lexer->memoryUsage().sources == memory.sources);
+
+    // so is input whose tokens don't fit in the budget
+    lexer->setMemoryBudget(lexer->memoryUsage().total() + 1000);
+    behavedAsExpected = false;
+    try
+    {
+        lexer->lex(s);
+    }
+    catch (LexerMemoryError &e)
+    {
+        behavedAsExpected = true;
+    }
+    assert(behavedAsExpected);
+
+    // tokens freed by a token queue are no longer counted
+    lexer->reset();
+    lexer->setMemoryBudget(0);
+    lexer->lex(s);
+    size_t tokens = lexer->memoryUsage().tokens;
+    TokenQueue tq = lexer->getTokenQueue();
+    while (tq.dropHead() != nullptr)
+    {
+    }
+    assert(lexer->memoryUsage().tokens < tokens);
+    delete lexer;
+
+    // a pattern whose automaton needs a state for each of the last 13 bytes
+    // seen, matched against one long run of pseudo-random input
+    const TokenType run("run", "[ab]*a[ab]{12}", IdentToken::lex);
+    string ab;
+    unsigned int seed = 1;
+    for (int i = 0; i < 20000; i++)
+    {
+        seed = seed * 1103515245 + 12345;
+        ab += (seed >> 16) & 1 ? 'a' : 'b';
+    }
+    ab[ab.size() - 13] = 'a';
+
+    // the states it keeps are capped, even within a match
+    lexer = new Lexer();
+    lexer->registerTokenType(&run);
+    lexer->lex(ab);
+    auto token = dynamic_cast<const IdentToken *>(
+        lexer->getTokenQueue().getHead());
+    assert(token != nullptr && token->name == ab);
+    assert(lexer->memoryUsage().matcher < 600000);
+    delete lexer;
+
+    // and the budget is enforced as they are added, not just once the token
+    // has been found
+    lexer = new Lexer();
+    lexer->registerTokenType(&run);
+    lexer->setMemoryBudget(lexer->memoryUsage().total() + ab.size() + 100000);
+    behavedAsExpected = false;
+    try
+    {
+        lexer->lex(ab);
+    }
+    catch (LexerMemoryError &e)
+    {
+        behavedAsExpected = true;
+    }
+    assert(behavedAsExpected);
+    assert(lexer->getTokenQueue().getHead() == nullptr);
+
+    // cleanup
+    delete lexer;
+}
+
+// check that patterns match UTF-8 text a character at a time, and that
+// Unicode general categories can be used in patterns
+void lexerTest10()
+{
+    // create a lexer and register token types
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&WordToken::tokenType);
+    lexer->registerTokenType(&QuotedToken::tokenType);
+
+    // program string
+    string s = "größe «naïve café» 変数2 Δx";
+
+    // lex program string
+    lexer->lex(s);
+
+    // check output
+    TokenQueue tq = lexer->getTokenQueue();
+    const WordToken *word = dynamic_cast<const WordToken *>(tq.getHead());
+    assert(word != nullptr && word->word == "größe");
+    tq.dropHead();
+    const QuotedToken *quoted =
+        dynamic_cast<const QuotedToken *>(tq.dropHead());
+    assert(quoted != nullptr && quoted->text == "naïve café");
+    tq.dropHead();
+    word = dynamic_cast<const WordToken *>(tq.dropHead());
+    assert(word != nullptr && word->word == "変数2");
+    tq.dropHead();
+    word = dynamic_cast<const WordToken *>(tq.dropHead());
+    assert(word != nullptr && word->word == "Δx");
+    assert(tq.dropHead() == nullptr);
+
+    // a character that no pattern matches is reported whole
+    bool behavedAsExpected = false;
+    try
+    {
+        lexer->lex("x € y");
+    }
+    catch (runtime_error &e)
+    {
+        behavedAsExpected =
+            string(e.what()).find("\"€\" at position 2") != string::npos;
+    }
+    assert(behavedAsExpected);
+
+    // unknown categories are reported when the pattern is compiled
+    delete lexer;
+    lexer = new Lexer();
+    TokenType unknown("unknown", "\\p{Xx}+", WordToken::lex);
+    lexer->registerTokenType(&unknown);
+    behavedAsExpected = false;
+    try
+    {
+        lexer->lex("x");
+    }
+    catch (regex_error &e)
+    {
+        behavedAsExpected = e.code() == regex_constants::error_ctype;
+    }
+    assert(behavedAsExpected);
+
+    // so are malformed braces, with the codes std::regex gives
+    pair<const char *, regex_constants::error_type> braces[] = {
+        {"a{", regex_constants::error_badbrace},
+        {"a{,2}", regex_constants::error_badbrace},
+        {"a{1x}", regex_constants::error_badbrace},
+        {"a{1,", regex_constants::error_brace}};
+    for (auto &brace : braces)
+    {
+        delete lexer;
+        lexer = new Lexer();
+        TokenType malformed("malformed", brace.first, WordToken::lex);
+        lexer->registerTokenType(&malformed);
+        behavedAsExpected = false;
+        try
+        {
+            lexer->lex("a");
+        }
+        catch (regex_error &e)
+        {
+            behavedAsExpected = e.code() == brace.second;
+        }
+        assert(behavedAsExpected);
+    }
+
+    // cleanup
+    delete lexer;
+}
+
+// check that lex functions get the same match whether a token was found by an
+// automaton or by std::regex
+void lexerTest11()
+{
+    // the assertion means this pattern can't have an automaton
+    const TokenType restBefore("rest before space", "[a-z]+(?= )", RestToken::lex);
+
+    for (const TokenType *restType : {&RestToken::tokenType, &restBefore})
+    {
+        // create a lexer and register token types
+        Lexer *lexer = new Lexer();
+        lexer->registerTokenType(&WhitespaceToken::tokenType);
+        lexer->registerTokenType(restType);
+        lexer->registerTokenType(&RestToken::tokenType);
+
+        // lex program string
+        lexer->lex("ab cd ef");
+
+        // the match is over the whole input, so the position is the token's
+        // and the suffix runs to the end of the input
+        TokenQueue tq = lexer->getTokenQueue();
+        const RestToken *token = dynamic_cast<const RestToken *>(tq.getHead());
+        assert(token != nullptr && token->rest == " cd ef");
+        assert(token->position == 0);
+        tq.dropHead();
+        token = dynamic_cast<const RestToken *>(tq.dropHead());
+        assert(token != nullptr && token->rest == " ef");
+        assert(token->position == 3);
+        tq.dropHead();
+        token = dynamic_cast<const RestToken *>(tq.dropHead());
+        assert(token != nullptr && token->rest == "");
+
+        // cleanup
+        delete lexer;
+    }
+}
+
+// lex a string with whitespace and one other token type, returning the other
+// tokens separated by "|", or "error" if some of the string wasn't matched
+string lexWords(const TokenType *wordType, const string &s)
+{
+    Lexer lexer;
+    lexer.registerTokenType(&WhitespaceToken::tokenType);
+    lexer.registerTokenType(wordType);
+
+    string words;
+    try
+    {
+        lexer.lex(s);
+    }
+    catch (runtime_error &e)
+    {
+        return "error";
+    }
+
+    TokenQueue tq = lexer.getTokenQueue();
+    for (const BaseToken *token = tq.getHead(); token != nullptr;
+         token = tq.dropHead())
+    {
+        auto word = dynamic_cast<const WordToken *>(token);
+        if (word != nullptr)
+            words += word->word + "|";
+    }
+    return words;
+}
+
+// check that input that isn't valid UTF-8 is matched a byte at a time, the
+// same way by automata and by std::regex
+void lexerTest12()
+{
+    // negated sets match stray bytes, and "\xHH" matches a byte
+    const TokenType notSpace("not space", "[^ ]+", WordToken::lex);
+    const TokenType high("high", "[\\x80-\\xff]+", WordToken::lex);
+    const TokenType notE("not e", "[^\xc3\xa9]+", WordToken::lex);
+    const TokenType any("any", ".+", WordToken::lex);
+    const TokenType e9("e9", "\\xe9", WordToken::lex);
+    assert(lexWords(&notSpace, "caf\xe9 x") == "caf\xe9|x|");
+    assert(lexWords(&high, "\xe9\xff \xc3\xa9") == "\xe9\xff|\xc3\xa9|");
+    assert(lexWords(&notE, "a\xc3\xa9") == "error");
+    assert(lexWords(&notE, "a\xc3") == "a\xc3|");
+    assert(lexWords(&any, "\xe9\x80\xc3\xa9") == "\xe9\x80\xc3\xa9|");
+    assert(lexWords(&e9, "\xe9") == "\xe9|");
+    assert(lexWords(&e9, "\xc3\xa9") == "error");
+
+    // the same patterns with an assertion that always holds are matched by
+    // std::regex, and must give the same tokens
+    const char *pats[] = {"[^ ]+", ".+", "[\\x80-\\xff]+", "[^\xc3\xa9]+",
+                          "\\xe9a?", "(?:\xc3\xa9|\\xc3)\\xa9?", "\\W+",
+                          "[a\\xe9-\\xff]+", "\\P{L}+", "\xe9+"};
+    const char alphabet[] = {'a', ' ', '\xc3', '\xa9', '\xe9', '\xff', '\x80',
+                             '\n'};
+    unsigned int seed = 1;
+    for (const char *pat : pats)
+    {
+        const TokenType automaton("automaton", pat, WordToken::lex);
+        const TokenType regex("regex", string(pat) + "(?![^\\s\\S])",
+                              WordToken::lex);
+        for (int i = 0; i < 300; i++)
+        {
+            string s;
+            seed = seed * 1103515245 + 12345;
+            for (unsigned int n = (seed >> 16) % 9; n > 0; n--)
+            {
+                seed = seed * 1103515245 + 12345;
+                s += alphabet[(seed >> 16) % sizeof(alphabet)];
+            }
+            assert(lexWords(&automaton, s) == lexWords(&regex, s));
+        }
+    }
+}
+
+// check that long tokens are lexed, including ones matched by std::regex,
+// whose matcher recurses for each character
+void lexerTest13()
+{
+    const TokenType comment("comment", "//.*", WordToken::lex);
+    const TokenType literal("literal", "\"[^\"]*\"", WordToken::lex);
+    const TokenType quoted("quoted", "\"([^\"]*)\"", QuotedToken::lex);
+    const TokenType before("before end", "\"[^\"]*\"(?![^\\s\\S])",
+                           WordToken::lex);
+
+    string text(20000, 'x');
+    assert(lexWords(&comment, "//" + text) == "//" + text + "|");
+    assert(lexWords(&literal, "\"" + text + "\"") == "\"" + text + "\"|");
+
+    // the groups are found by std::regex, as is the whole token when the
+    // pattern has an assertion
+    text.resize(10000);
+    Lexer lexer;
+    lexer.registerTokenType(&quoted);
+    lexer.lex("\"" + text + "\"");
+    auto token = dynamic_cast<const QuotedToken *>(
+        lexer.getTokenQueue().getHead());
+    assert(token != nullptr && token->text == text);
+    assert(lexWords(&before, "\"" + text + "\"") == "\"" + text + "\"|");
+}
+
+// check that lexers given back to a pool are reused
+void poolTest1()
+{
+    LexerPool pool([](Lexer *lexer)
+                   {
+                       lexer->registerTokenType(&WhitespaceToken::tokenType);
+                       lexer->registerTokenType(&UIntToken::tokenType);
+                       lexer->setRecordCandidates(true);
+                   });
+
+    Lexer *a = pool.acquire();
+    Lexer *b = pool.acquire();
+    assert(a != b);
+
+    a->lex("1 2 3");
+    size_t tokens = a->memoryUsage().tokens;
+
+    // tokens taken from a token queue leave their list nodes for reuse
+    TokenQueue tq = a->getTokenQueue();
+    while (tq.getHead() != nullptr)
+    {
+        tq.dropHead();
+    }
+    assert(a->memoryUsage().tokens == tokens - 5 * sizeof(BaseToken));
+    pool.release(a);
+
+    // the released lexer is handed out again, reset
+    Lexer *c = pool.acquire();
+    assert(c == a);
+    assert(c->getTokenQueue().getHead() == nullptr);
+    c->lex("4");
+    assert(c->candidatesString() == "uint candidate: \"4\"\n");
+
+    pool.release(b);
+    pool.release(c);
+}
+
+// check that threads can share a pool, each lexing with its own lexer
+void poolTest2()
+{
+    LexerPool pool([](Lexer *lexer)
+                   {
+                       lexer->registerTokenType(&WhitespaceToken::tokenType);
+                       lexer->registerTokenType(&UIntToken::tokenType);
+                   });
+
+    // each thread lexes its own string repeatedly, checking every token and
+    // recording failures in its own element of `ok` (not a vector<bool>, whose
+    // elements share bytes)
+    vector<thread> threads;
+    vector<char> ok(8, true);
+    for (unsigned int t = 0; t < ok.size(); t++)
+    {
+        threads.emplace_back([&pool, &ok, t]()
+                             {
+            string s;
+            for (unsigned int i = 0; i < 50; i++)
+            {
+                s += to_string(t * 1000 + i) + " ";
+            }
+            for (unsigned int i = 0; i < 100; i++)
+            {
+                Lexer *lexer = pool.acquire();
+                lexer->lex(s);
+                TokenQueue tq = lexer->getTokenQueue();
+                for (unsigned int j = 0; j < 50; j++, tq.dropHead())
+                {
+                    auto token = dynamic_cast<const UIntToken *>(tq.getHead());
+                    if (token == nullptr || token->val != t * 1000 + j)
+                        ok[t] = false;
+                    tq.dropHead();
+                }
+                pool.release(lexer);
+            } });
+    }
+    for (thread &t : threads)
+    {
+        t.join();
+    }
+
+    for (unsigned int t = 0; t < ok.size(); t++)
+    {
+        assert(ok[t]);
+    }
+}
+
 void tokenQueueTest1()
 {
 
@@ -229,12 +1105,144 @@ void tokenQueueTest1()
     delete lexer;
 }
 
+// check that tokens lexed into a stream can be iterated and found by index,
+// and are stored compactly
+void streamTest1()
+{
+    // create a lexer and register token types
+    Lexer *lexer = new Lexer();
+    lexer->registerTokenType(&WhitespaceToken::tokenType);
+    lexer->registerTokenType(&UIntToken::tokenType);
+    lexer->registerTokenType(&IntToken::tokenType);
+
+    // lex program string into a stream
+    TokenStream stream;
+    lexer->lex("12 -24", stream);
+    assert(stream.size() == 3);
+
+    // iterate through tokens
+    TokenStreamQueue tq = stream.getTokenQueue();
+    const TokenSpan *span = tq.getHead();
+    assert(span->tokenType == &UIntToken::tokenType);
+    assert(span->position == 0 && span->length == 2);
+    span = tq.dropHead();
+    assert(span->tokenType == &WhitespaceToken::tokenType);
+    assert(span->position == 2 && span->length == 1);
+    span = tq.dropHead();
+    assert(span->tokenType == &IntToken::tokenType);
+    assert(span->position == 3 && span->length == 3);
+    assert(tq.dropHead() == nullptr);
+
+    // another string is a new source, whose positions start from 0
+    stream.clear();
+    lexer->lex("1 2", stream);
+    lexer->lex("", stream);
+    lexer->lex("3 4", stream);
+    assert(stream.size() == 6);
+    assert(stream.at(2).source == 0 && stream.at(2).position == 2);
+    assert(stream.at(3).source == 2 && stream.at(3).position == 0);
+    assert(stream.at(5).source == 2 && stream.at(5).position == 2);
+
+    // tokens with gaps between them, over several blocks
+    stream.clear();
+    for (size_t i = 0; i < 1000; i++)
+    {
+        stream.append(i % 2 ? &UIntToken::tokenType : &IntToken::tokenType,
+                      i * 200 + (i % 3), i % 150);
+    }
+    assert(stream.size() == 1000);
+    for (size_t i : {0, 127, 128, 129, 500, 999})
+    {
+        TokenSpan token = stream.at(i);
+        assert(token.tokenType ==
+               (i % 2 ? &UIntToken::tokenType : &IntToken::tokenType));
+        assert(token.position == i * 200 + (i % 3));
+        assert(token.length == i % 150);
+    }
+    tq = stream.getTokenQueue(998);
+    assert(tq.getHead()->position == 998 * 200 + 2);
+    assert(tq.dropHead()->position == 999 * 200);
+    assert(tq.dropHead() == nullptr);
+    assert(stream.getTokenQueue(1000).getHead() == nullptr);
+    stream.startSource();
+    stream.append(&UIntToken::tokenType, 5, 1);
+    assert(stream.at(1000).source == 1 && stream.at(1000).position == 5);
+    assert(stream.at(999).source == 0);
+
+    // tokens must be appended in order
+    bool behavedAsExpected = false;
+    try
+    {
+        stream.append(&UIntToken::tokenType, 0, 1);
+    }
+    catch (runtime_error &e)
+    {
+        behavedAsExpected = true;
+    }
+    assert(behavedAsExpected);
+
+    behavedAsExpected = false;
+    try
+    {
+        stream.at(1001);
+    }
+    catch (out_of_range &e)
+    {
+        behavedAsExpected = true;
+    }
+    assert(behavedAsExpected);
+
+    // contiguous tokens of a large input take a few bytes each
+    string s;
+    for (size_t i = 0; i < 100000; i++)
+    {
+        s += to_string(i) + " ";
+    }
+    stream.clear();
+    lexer->lex(s, stream);
+    assert(stream.size() == 200000);
+    assert(stream.memory() < stream.size() * 4);
+    assert(stream.at(199999).position == s.size() - 1);
+
+    // the stream's growth counts towards the memory budget
+    TokenStream small;
+    lexer->setMemoryBudget(lexer->memoryUsage().total() + 10000);
+    behavedAsExpected = false;
+    try
+    {
+        lexer->lex(s, small);
+    }
+    catch (LexerMemoryError &e)
+    {
+        behavedAsExpected = true;
+    }
+    assert(behavedAsExpected);
+    assert(small.size() > 0 && small.size() < 200000);
+
+    // cleanup
+    delete lexer;
+}
+
 // program entry - run all tests and debug if required
 int main(void)
 {
     lexerTest1();
     lexerTest2();
+    lexerTest3();
+    lexerTest4();
+    lexerTest5();
+    lexerTest6();
+    lexerTest7();
+    lexerTest8();
+    lexerTest9();
+    lexerTest10();
+    lexerTest11();
+    lexerTest12();
+    lexerTest13();
+    poolTest1();
+    poolTest2();
     tokenQueueTest1();
+    streamTest1();
     // lexerDebug();
 }
 
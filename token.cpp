@@ -36,56 +36,18 @@ BaseToken::~BaseToken() {}
 // ======================
 
 // constructor
-CandidateToken::CandidateToken(const TokenType *tokenType, const smatch match,
-							   const string *src)
-	: tokenType(tokenType), match(match), src(src) {}
-
-// compare two candidate tokens by their starting positions
-bool CandidateToken::cmpPos(const CandidateToken *&a, const CandidateToken *&b)
-{
-	return a->match.position(0) < b->match.position(0);
-}
-
-// compare two candidate tokens by length
-bool CandidateToken::isLonger(const CandidateToken *&other) const
-{
-	return this->match.length(0) > other->match.length(0);
-}
-
-// indicate if two candidates overlap/intersect each other
-bool CandidateToken::intersects(const CandidateToken *&other) const
-{
-	unsigned int thisStart = this->match.position(0),
-				 thisLength = this->match.length(0);
-
-	unsigned int otherStart = other->match.position(0),
-				 otherLength = other->match.length(0);
-
-	// if this starts first
-	if (thisStart < otherStart)
-	{
-		// intersection occurs when other starts before this ends
-		// in other words, the end of this occurs after the start of other
-		return thisStart + thisLength > otherStart;
-	}
-
-	// if other starts first
-	else if (thisStart > otherStart)
-	{
-		// intersection occurs when this starts before other ends
-		// in other words, the end of other occurs after the start of this
-		return otherStart + otherLength > thisStart;
-	}
-	// if the two start in the sampe place they must intersect
-	return true;
-}
+CandidateToken::CandidateToken(const TokenType *tokenType, const string *src,
+							   size_t position, size_t length)
+	: tokenType(tokenType), src(src), position(position), length(length) {}
 
 // ==================
 // TokenQueue methods
 // ==================
 
 // constructor
-TokenQueue::TokenQueue(list<const BaseToken *> *data) : data(data) {}
+TokenQueue::TokenQueue(list<const BaseToken *> *data,
+					   list<const BaseToken *> *spare)
+	: data(data), spare(spare) {}
 
 // return the first element or null if the list is empty
 const BaseToken *TokenQueue::getHead() const
@@ -108,14 +70,17 @@ const BaseToken *TokenQueue::dropHead()
 	// delete the first data item
 	delete data->front();
 
-	// remove the first node from the list
-	auto next = data->erase(data->begin());
+	// remove the first node from the list, keeping it for reuse if possible
+	if (spare != nullptr)
+		spare->splice(spare->end(), *data, data->begin());
+	else
+		data->erase(data->begin());
 
 	// decide what to return
-	if (next == data->end())
+	if (data->empty())
 		return nullptr;
 	else
-		return *next;
+		return data->front();
 }
 
 #ifndef NDEBUG
@@ -146,7 +111,8 @@ string BaseToken::toString() const
 string CandidateToken::toString() const
 {
 	ostringstream ss;
-	ss << tokenType->name << " candidate: \"" << match.str(0) << '"';
+	ss << tokenType->name << " candidate: \"" << src->substr(position, length)
+	   << '"';
 	return ss.str();
 }
 
@@ -30,7 +30,10 @@ struct TokenType
 	/// token type.
 	const string pat;
 
-	/// @brief Function to lex tokens of this token type.
+	/// @brief Function to lex tokens of this token type. The match it is
+	/// given is over the whole string being lexed, so `position(0)` is the
+	/// token's position in the string, `prefix()` is the input before the
+	/// token and `suffix()` is the input after it.
 	const function<const BaseToken *(const smatch *)> lexFn;
 
 	/// @brief Constructor.
@@ -79,36 +82,22 @@ struct CandidateToken
 	/// class of `BaseToken`).
 	const TokenType *tokenType;
 
-	/// @brief The match of the program string with the token type's pattern.
-	const smatch match;
-
+	/// @brief The program string that was matched.
 	const string *src;
 
+	/// @brief Position of the start of the candidate in `src`.
+	const size_t position;
+
+	/// @brief Length of the candidate in `src`.
+	const size_t length;
+
 	/// @brief Constructor.
 	/// @param tokenType The type of token whose pattern was matched.
-	/// @param match The match of the program string with the token type's
-	/// pattern.
-	CandidateToken(const TokenType *tokenType, const smatch match,
-				   const string *src);
-
-	/// @brief Compare two candidate tokens by their starting positions.
-	/// Returns `true` if `a` starts before `b`.
-	/// @param a A candidate token.
-	/// @param b A candidate token.
-	/// @return `true` if `a` starts before `b`, else `false`.
-	static bool cmpPos(const CandidateToken *&a, const CandidateToken *&b);
-
-	/// @brief Compare two candidate tokens by their lengths. Returns `true` if
-	/// `this` is longer than `other`, else `false`.
-	/// @param other Another candidate token.
-	/// @return `true` if `this` is longer than `other`, else `false`.
-	bool isLonger(const CandidateToken *&other) const;
-
-	/// @brief Indicates whether two candidate tokens intersect/overlap in the
-	/// text.
-	/// @param other Another candidate token.
-	/// @return `true` if `this` overlaps with `other`, else `false`.
-	bool intersects(const CandidateToken *&other) const;
+	/// @param src The program string that was matched.
+	/// @param position Position of the start of the candidate in `src`.
+	/// @param length Length of the candidate in `src`.
+	CandidateToken(const TokenType *tokenType, const string *src,
+				   size_t position, size_t length);
 
 #ifndef NDEBUG
 	/// @brief Get a string representation of this candidate token (debug only).
@@ -125,10 +114,17 @@ private:
 	/// @brief Pointer to a list of token pointers (stored in the lexer).
 	list<const BaseToken *> *data;
 
+	/// @brief Pointer to a list that takes the nodes of dropped tokens for
+	/// reuse (stored in the lexer), or `nullptr` to free them.
+	list<const BaseToken *> *spare;
+
 public:
 	/// @brief Constructor.
 	/// @param data Pointer to a list of token pointers (stored in the lexer).
-	TokenQueue(list<const BaseToken *> *data);
+	/// @param spare Pointer to a list that takes the nodes of dropped tokens
+	/// for reuse (stored in the lexer), or `nullptr` to free them.
+	TokenQueue(list<const BaseToken *> *data,
+			   list<const BaseToken *> *spare = nullptr);
 
 	/// @brief Get the first element in the list. Return `nullptr` if the list
 	/// is empty.
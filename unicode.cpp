@@ -0,0 +1,1398 @@
+/**
+ * @file unicode.cpp
+ *
+ * @brief Implements methods for the `CodePointSet` class, and holds the table
+ * of Unicode general categories.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#include "unicode.hpp"
+
+#include <algorithm>
+using namespace std;
+
+// ==================
+// General categories
+// ==================
+
+/* the general categories, in the order of the category numbers used by
+`categoryRanges` (at the end of this file). unassigned code points (Cn) aren't
+in the table; they are whatever is left over. */
+static const char *const categoryNames[][2] = {
+    {"Lu", "Uppercase_Letter"},
+    {"Ll", "Lowercase_Letter"},
+    {"Lt", "Titlecase_Letter"},
+    {"Lm", "Modifier_Letter"},
+    {"Lo", "Other_Letter"},
+    {"Mn", "Nonspacing_Mark"},
+    {"Mc", "Spacing_Mark"},
+    {"Me", "Enclosing_Mark"},
+    {"Nd", "Decimal_Number"},
+    {"Nl", "Letter_Number"},
+    {"No", "Other_Number"},
+    {"Pc", "Connector_Punctuation"},
+    {"Pd", "Dash_Punctuation"},
+    {"Ps", "Open_Punctuation"},
+    {"Pe", "Close_Punctuation"},
+    {"Pi", "Initial_Punctuation"},
+    {"Pf", "Final_Punctuation"},
+    {"Po", "Other_Punctuation"},
+    {"Sm", "Math_Symbol"},
+    {"Sc", "Currency_Symbol"},
+    {"Sk", "Modifier_Symbol"},
+    {"So", "Other_Symbol"},
+    {"Zs", "Space_Separator"},
+    {"Zl", "Line_Separator"},
+    {"Zp", "Paragraph_Separator"},
+    {"Cc", "Control"},
+    {"Cf", "Format"},
+    {"Cs", "Surrogate"},
+    {"Co", "Private_Use"},
+    {"Cn", "Unassigned"}};
+
+// number of general categories, including Cn
+static const unsigned int categoryCount =
+    sizeof(categoryNames) / sizeof(categoryNames[0]);
+
+// names of the groups of categories that share a first letter
+static const char *const groupNames[][2] = {
+    {"L", "Letter"},
+    {"M", "Mark"},
+    {"N", "Number"},
+    {"P", "Punctuation"},
+    {"S", "Symbol"},
+    {"Z", "Separator"},
+    {"C", "Other"}};
+
+// a range of code points in one general category
+struct CategoryRange
+{
+    unsigned int lo, hi;
+    unsigned char category;
+};
+
+extern const CategoryRange categoryRanges[];
+extern const size_t categoryRangeCount;
+
+// =====================
+// CodePointSet methods
+// =====================
+
+// the highest code point (defined here since `make_pair` takes a reference)
+const unsigned int CodePointSet::maxCodePoint;
+
+// add a range of code points
+void CodePointSet::add(unsigned int lo, unsigned int hi)
+{
+    if (hi > maxCodePoint)
+        hi = maxCodePoint;
+    if (lo > hi)
+        return;
+
+    // ranges that overlap or touch the new one are merged with it
+    auto first = lower_bound(ranges.begin(), ranges.end(), lo,
+                             [](const pair<unsigned int, unsigned int> &range,
+                                unsigned int c)
+                             { return range.second + 1 < c; });
+    auto last = first;
+    while (last != ranges.end() && last->first <= hi + 1)
+    {
+        lo = min(lo, last->first);
+        hi = max(hi, last->second);
+        last++;
+    }
+
+    first = ranges.erase(first, last);
+    ranges.insert(first, make_pair(lo, hi));
+}
+
+// add a single code point
+void CodePointSet::add(unsigned int c)
+{
+    add(c, c);
+}
+
+// add the code points in another set
+void CodePointSet::add(const CodePointSet &other)
+{
+    for (const pair<unsigned int, unsigned int> &range : other.ranges)
+    {
+        add(range.first, range.second);
+    }
+}
+
+// replace the set with its complement
+void CodePointSet::invert()
+{
+    vector<pair<unsigned int, unsigned int>> inverted;
+    unsigned int next = 0;
+    for (const pair<unsigned int, unsigned int> &range : ranges)
+    {
+        if (range.first > next)
+            inverted.push_back(make_pair(next, range.first - 1));
+        next = range.second + 1;
+    }
+    if (next <= maxCodePoint)
+        inverted.push_back(make_pair(next, maxCodePoint));
+
+    ranges.swap(inverted);
+}
+
+// check whether the set contains a code point
+bool CodePointSet::contains(unsigned int c) const
+{
+    auto it = lower_bound(ranges.begin(), ranges.end(), c,
+                          [](const pair<unsigned int, unsigned int> &range,
+                             unsigned int c)
+                          { return range.second < c; });
+    return it != ranges.end() && it->first <= c;
+}
+
+// check whether the set is empty
+bool CodePointSet::empty() const
+{
+    return ranges.empty();
+}
+
+// get the ranges in the set
+const vector<pair<unsigned int, unsigned int>> &CodePointSet::getRanges() const
+{
+    return ranges;
+}
+
+// bytes that the encodings of the set's code points start with
+bitset<256> CodePointSet::firstBytes() const
+{
+    bitset<256> bytes;
+    for (const vector<ByteRange> &sequence : utf8Sequences())
+    {
+        for (unsigned int b = sequence.front().first;
+             b <= sequence.front().second; b++)
+        {
+            bytes.set(b);
+        }
+    }
+    return bytes;
+}
+
+// length of the longest encoding of a code point in the set
+unsigned int CodePointSet::maxEncodedLength() const
+{
+    size_t length = 0;
+    for (const vector<ByteRange> &sequence : utf8Sequences())
+    {
+        length = max(length, sequence.size());
+    }
+    return length;
+}
+
+// number of bytes in the UTF-8 encoding of a code point
+static unsigned int encodedLength(unsigned int c)
+{
+    return c <= 0x7f ? 1 : c <= 0x7ff ? 2 : c <= 0xffff ? 3 : 4;
+}
+
+// UTF-8 encoding of a code point
+static void encode(unsigned int c, unsigned char *bytes)
+{
+    unsigned int length = encodedLength(c);
+    if (length == 1)
+    {
+        bytes[0] = c;
+        return;
+    }
+
+    // continuation bytes hold 6 bits each, the lead byte the rest
+    for (unsigned int i = length - 1; i > 0; i--)
+    {
+        bytes[i] = 0x80 | (c & 0x3f);
+        c >>= 6;
+    }
+    bytes[0] = (0xf00 >> length) | c;
+}
+
+/* a range of code points whose encodings have the same length is split until
+each piece is the cartesian product of byte ranges, i.e. the pieces' first and
+last code points differ only in a prefix of bytes, followed by bytes that span
+all continuation bytes in the first code point's encoding (0x80) to the last's
+(0xbf). this is the construction used by RE2 and Rust's regex crate. */
+static void encodeRange(unsigned int lo, unsigned int hi,
+                        vector<vector<ByteRange>> &sequences)
+{
+    // split where the encoded length changes
+    static const unsigned int lengthLimits[] = {0x7f, 0x7ff, 0xffff};
+    for (unsigned int limit : lengthLimits)
+    {
+        if (lo <= limit && limit < hi)
+        {
+            encodeRange(lo, limit, sequences);
+            encodeRange(limit + 1, hi, sequences);
+            return;
+        }
+    }
+
+    // split where the trailing bytes don't span the continuation range
+    unsigned int length = encodedLength(lo);
+    for (unsigned int i = 1; i < length; i++)
+    {
+        unsigned int mask = (1u << (6 * i)) - 1;
+        if ((lo & ~mask) == (hi & ~mask))
+            continue;
+
+        if ((lo & mask) != 0)
+        {
+            encodeRange(lo, lo | mask, sequences);
+            encodeRange((lo | mask) + 1, hi, sequences);
+            return;
+        }
+        if ((hi & mask) != mask)
+        {
+            encodeRange(lo, (hi & ~mask) - 1, sequences);
+            encodeRange(hi & ~mask, hi, sequences);
+            return;
+        }
+    }
+
+    unsigned char first[4], last[4];
+    encode(lo, first);
+    encode(hi, last);
+
+    vector<ByteRange> sequence;
+    for (unsigned int i = 0; i < length; i++)
+    {
+        sequence.push_back(ByteRange(first[i], last[i]));
+    }
+    sequences.push_back(sequence);
+}
+
+// convert the set to sequences of byte ranges
+vector<vector<ByteRange>> CodePointSet::utf8Sequences() const
+{
+    static const unsigned int surrogatesLo = 0xd800, surrogatesHi = 0xdfff;
+
+    vector<vector<ByteRange>> sequences;
+    for (const pair<unsigned int, unsigned int> &range : ranges)
+    {
+        if (range.first < surrogatesLo)
+            encodeRange(range.first, min(range.second, surrogatesLo - 1),
+                        sequences);
+        if (range.second > surrogatesHi)
+            encodeRange(max(range.first, surrogatesHi + 1), range.second,
+                        sequences);
+    }
+    return sequences;
+}
+
+// look up a general category
+bool CodePointSet::category(const string &name, CodePointSet &set)
+{
+    // work out which categories the name covers, one bit per category
+    unsigned long categories = 0;
+    for (unsigned int i = 0; i < categoryCount; i++)
+    {
+        if (name == categoryNames[i][0] || name == categoryNames[i][1])
+            categories |= 1ul << i;
+    }
+    for (const auto &group : groupNames)
+    {
+        if (name != group[0] && name != group[1])
+            continue;
+        for (unsigned int i = 0; i < categoryCount; i++)
+        {
+            if (categoryNames[i][0][0] == group[0][0])
+                categories |= 1ul << i;
+        }
+    }
+    if (name == "LC" || name == "L&" || name == "Cased_Letter")
+        categories |= 0x7; // Lu, Ll and Lt
+
+    if (categories == 0)
+        return false;
+
+    set = CodePointSet();
+    for (size_t i = 0; i < categoryRangeCount; i++)
+    {
+        const CategoryRange &range = categoryRanges[i];
+        if (categories & (1ul << range.category))
+            set.add(range.lo, range.hi);
+    }
+
+    // unassigned code points are the ones that aren't in any other category
+    if (categories & (1ul << (categoryCount - 1)))
+    {
+        CodePointSet assigned;
+        for (size_t i = 0; i < categoryRangeCount; i++)
+        {
+            assigned.add(categoryRanges[i].lo, categoryRanges[i].hi);
+        }
+        assigned.invert();
+        set.add(assigned);
+    }
+
+    return true;
+}
+
+// decode the UTF-8 encoding of a code point
+unsigned int CodePointSet::decode(const string &s, size_t &position)
+{
+    unsigned char lead = s[position];
+    unsigned int length = lead < 0x80   ? 1
+                          : lead < 0xc2 ? 0
+                          : lead < 0xe0 ? 2
+                          : lead < 0xf0 ? 3
+                          : lead < 0xf5 ? 4
+                                        : 0;
+
+    if (length > 1 && position + length <= s.size())
+    {
+        unsigned int c = lead & (0x7f >> length);
+        unsigned int i = 1;
+        for (; i < length && ((unsigned char)s[position + i] & 0xc0) == 0x80;
+             i++)
+        {
+            c = c << 6 | ((unsigned char)s[position + i] & 0x3f);
+        }
+
+        // reject overlong encodings, surrogates and code points past the end
+        // of Unicode
+        if (i == length && encodedLength(c) == length &&
+            (c < 0xd800 || c > 0xdfff) && c <= maxCodePoint)
+        {
+            position += length;
+            return c;
+        }
+    }
+
+    position++;
+    return lead;
+}
+
+// =====================
+// General category data
+// =====================
+
+/* generated from the Unicode Character Database, version 14.0.0: each entry
+is a range of code points and the index of its category in `categoryNames`. */
+const CategoryRange categoryRanges[] = {
+    {0x0, 0x1f, 25}, {0x20, 0x20, 22}, {0x21, 0x23, 17}, {0x24, 0x24, 19},
+    {0x25, 0x27, 17}, {0x28, 0x28, 13}, {0x29, 0x29, 14}, {0x2a, 0x2a, 17},
+    {0x2b, 0x2b, 18}, {0x2c, 0x2c, 17}, {0x2d, 0x2d, 12}, {0x2e, 0x2f, 17},
+    {0x30, 0x39, 8}, {0x3a, 0x3b, 17}, {0x3c, 0x3e, 18}, {0x3f, 0x40, 17},
+    {0x41, 0x5a, 0}, {0x5b, 0x5b, 13}, {0x5c, 0x5c, 17}, {0x5d, 0x5d, 14},
+    {0x5e, 0x5e, 20}, {0x5f, 0x5f, 11}, {0x60, 0x60, 20}, {0x61, 0x7a, 1},
+    {0x7b, 0x7b, 13}, {0x7c, 0x7c, 18}, {0x7d, 0x7d, 14}, {0x7e, 0x7e, 18},
+    {0x7f, 0x9f, 25}, {0xa0, 0xa0, 22}, {0xa1, 0xa1, 17}, {0xa2, 0xa5, 19},
+    {0xa6, 0xa6, 21}, {0xa7, 0xa7, 17}, {0xa8, 0xa8, 20}, {0xa9, 0xa9, 21},
+    {0xaa, 0xaa, 4}, {0xab, 0xab, 15}, {0xac, 0xac, 18}, {0xad, 0xad, 26},
+    {0xae, 0xae, 21}, {0xaf, 0xaf, 20}, {0xb0, 0xb0, 21}, {0xb1, 0xb1, 18},
+    {0xb2, 0xb3, 10}, {0xb4, 0xb4, 20}, {0xb5, 0xb5, 1}, {0xb6, 0xb7, 17},
+    {0xb8, 0xb8, 20}, {0xb9, 0xb9, 10}, {0xba, 0xba, 4}, {0xbb, 0xbb, 16},
+    {0xbc, 0xbe, 10}, {0xbf, 0xbf, 17}, {0xc0, 0xd6, 0}, {0xd7, 0xd7, 18},
+    {0xd8, 0xde, 0}, {0xdf, 0xf6, 1}, {0xf7, 0xf7, 18}, {0xf8, 0xff, 1},
+    {0x100, 0x100, 0}, {0x101, 0x101, 1}, {0x102, 0x102, 0}, {0x103, 0x103, 1},
+    {0x104, 0x104, 0}, {0x105, 0x105, 1}, {0x106, 0x106, 0}, {0x107, 0x107, 1},
+    {0x108, 0x108, 0}, {0x109, 0x109, 1}, {0x10a, 0x10a, 0}, {0x10b, 0x10b, 1},
+    {0x10c, 0x10c, 0}, {0x10d, 0x10d, 1}, {0x10e, 0x10e, 0}, {0x10f, 0x10f, 1},
+    {0x110, 0x110, 0}, {0x111, 0x111, 1}, {0x112, 0x112, 0}, {0x113, 0x113, 1},
+    {0x114, 0x114, 0}, {0x115, 0x115, 1}, {0x116, 0x116, 0}, {0x117, 0x117, 1},
+    {0x118, 0x118, 0}, {0x119, 0x119, 1}, {0x11a, 0x11a, 0}, {0x11b, 0x11b, 1},
+    {0x11c, 0x11c, 0}, {0x11d, 0x11d, 1}, {0x11e, 0x11e, 0}, {0x11f, 0x11f, 1},
+    {0x120, 0x120, 0}, {0x121, 0x121, 1}, {0x122, 0x122, 0}, {0x123, 0x123, 1},
+    {0x124, 0x124, 0}, {0x125, 0x125, 1}, {0x126, 0x126, 0}, {0x127, 0x127, 1},
+    {0x128, 0x128, 0}, {0x129, 0x129, 1}, {0x12a, 0x12a, 0}, {0x12b, 0x12b, 1},
+    {0x12c, 0x12c, 0}, {0x12d, 0x12d, 1}, {0x12e, 0x12e, 0}, {0x12f, 0x12f, 1},
+    {0x130, 0x130, 0}, {0x131, 0x131, 1}, {0x132, 0x132, 0}, {0x133, 0x133, 1},
+    {0x134, 0x134, 0}, {0x135, 0x135, 1}, {0x136, 0x136, 0}, {0x137, 0x138, 1},
+    {0x139, 0x139, 0}, {0x13a, 0x13a, 1}, {0x13b, 0x13b, 0}, {0x13c, 0x13c, 1},
+    {0x13d, 0x13d, 0}, {0x13e, 0x13e, 1}, {0x13f, 0x13f, 0}, {0x140, 0x140, 1},
+    {0x141, 0x141, 0}, {0x142, 0x142, 1}, {0x143, 0x143, 0}, {0x144, 0x144, 1},
+    {0x145, 0x145, 0}, {0x146, 0x146, 1}, {0x147, 0x147, 0}, {0x148, 0x149, 1},
+    {0x14a, 0x14a, 0}, {0x14b, 0x14b, 1}, {0x14c, 0x14c, 0}, {0x14d, 0x14d, 1},
+    {0x14e, 0x14e, 0}, {0x14f, 0x14f, 1}, {0x150, 0x150, 0}, {0x151, 0x151, 1},
+    {0x152, 0x152, 0}, {0x153, 0x153, 1}, {0x154, 0x154, 0}, {0x155, 0x155, 1},
+    {0x156, 0x156, 0}, {0x157, 0x157, 1}, {0x158, 0x158, 0}, {0x159, 0x159, 1},
+    {0x15a, 0x15a, 0}, {0x15b, 0x15b, 1}, {0x15c, 0x15c, 0}, {0x15d, 0x15d, 1},
+    {0x15e, 0x15e, 0}, {0x15f, 0x15f, 1}, {0x160, 0x160, 0}, {0x161, 0x161, 1},
+    {0x162, 0x162, 0}, {0x163, 0x163, 1}, {0x164, 0x164, 0}, {0x165, 0x165, 1},
+    {0x166, 0x166, 0}, {0x167, 0x167, 1}, {0x168, 0x168, 0}, {0x169, 0x169, 1},
+    {0x16a, 0x16a, 0}, {0x16b, 0x16b, 1}, {0x16c, 0x16c, 0}, {0x16d, 0x16d, 1},
+    {0x16e, 0x16e, 0}, {0x16f, 0x16f, 1}, {0x170, 0x170, 0}, {0x171, 0x171, 1},
+    {0x172, 0x172, 0}, {0x173, 0x173, 1}, {0x174, 0x174, 0}, {0x175, 0x175, 1},
+    {0x176, 0x176, 0}, {0x177, 0x177, 1}, {0x178, 0x179, 0}, {0x17a, 0x17a, 1},
+    {0x17b, 0x17b, 0}, {0x17c, 0x17c, 1}, {0x17d, 0x17d, 0}, {0x17e, 0x180, 1},
+    {0x181, 0x182, 0}, {0x183, 0x183, 1}, {0x184, 0x184, 0}, {0x185, 0x185, 1},
+    {0x186, 0x187, 0}, {0x188, 0x188, 1}, {0x189, 0x18b, 0}, {0x18c, 0x18d, 1},
+    {0x18e, 0x191, 0}, {0x192, 0x192, 1}, {0x193, 0x194, 0}, {0x195, 0x195, 1},
+    {0x196, 0x198, 0}, {0x199, 0x19b, 1}, {0x19c, 0x19d, 0}, {0x19e, 0x19e, 1},
+    {0x19f, 0x1a0, 0}, {0x1a1, 0x1a1, 1}, {0x1a2, 0x1a2, 0}, {0x1a3, 0x1a3, 1},
+    {0x1a4, 0x1a4, 0}, {0x1a5, 0x1a5, 1}, {0x1a6, 0x1a7, 0}, {0x1a8, 0x1a8, 1},
+    {0x1a9, 0x1a9, 0}, {0x1aa, 0x1ab, 1}, {0x1ac, 0x1ac, 0}, {0x1ad, 0x1ad, 1},
+    {0x1ae, 0x1af, 0}, {0x1b0, 0x1b0, 1}, {0x1b1, 0x1b3, 0}, {0x1b4, 0x1b4, 1},
+    {0x1b5, 0x1b5, 0}, {0x1b6, 0x1b6, 1}, {0x1b7, 0x1b8, 0}, {0x1b9, 0x1ba, 1},
+    {0x1bb, 0x1bb, 4}, {0x1bc, 0x1bc, 0}, {0x1bd, 0x1bf, 1}, {0x1c0, 0x1c3, 4},
+    {0x1c4, 0x1c4, 0}, {0x1c5, 0x1c5, 2}, {0x1c6, 0x1c6, 1}, {0x1c7, 0x1c7, 0},
+    {0x1c8, 0x1c8, 2}, {0x1c9, 0x1c9, 1}, {0x1ca, 0x1ca, 0}, {0x1cb, 0x1cb, 2},
+    {0x1cc, 0x1cc, 1}, {0x1cd, 0x1cd, 0}, {0x1ce, 0x1ce, 1}, {0x1cf, 0x1cf, 0},
+    {0x1d0, 0x1d0, 1}, {0x1d1, 0x1d1, 0}, {0x1d2, 0x1d2, 1}, {0x1d3, 0x1d3, 0},
+    {0x1d4, 0x1d4, 1}, {0x1d5, 0x1d5, 0}, {0x1d6, 0x1d6, 1}, {0x1d7, 0x1d7, 0},
+    {0x1d8, 0x1d8, 1}, {0x1d9, 0x1d9, 0}, {0x1da, 0x1da, 1}, {0x1db, 0x1db, 0},
+    {0x1dc, 0x1dd, 1}, {0x1de, 0x1de, 0}, {0x1df, 0x1df, 1}, {0x1e0, 0x1e0, 0},
+    {0x1e1, 0x1e1, 1}, {0x1e2, 0x1e2, 0}, {0x1e3, 0x1e3, 1}, {0x1e4, 0x1e4, 0},
+    {0x1e5, 0x1e5, 1}, {0x1e6, 0x1e6, 0}, {0x1e7, 0x1e7, 1}, {0x1e8, 0x1e8, 0},
+    {0x1e9, 0x1e9, 1}, {0x1ea, 0x1ea, 0}, {0x1eb, 0x1eb, 1}, {0x1ec, 0x1ec, 0},
+    {0x1ed, 0x1ed, 1}, {0x1ee, 0x1ee, 0}, {0x1ef, 0x1f0, 1}, {0x1f1, 0x1f1, 0},
+    {0x1f2, 0x1f2, 2}, {0x1f3, 0x1f3, 1}, {0x1f4, 0x1f4, 0}, {0x1f5, 0x1f5, 1},
+    {0x1f6, 0x1f8, 0}, {0x1f9, 0x1f9, 1}, {0x1fa, 0x1fa, 0}, {0x1fb, 0x1fb, 1},
+    {0x1fc, 0x1fc, 0}, {0x1fd, 0x1fd, 1}, {0x1fe, 0x1fe, 0}, {0x1ff, 0x1ff, 1},
+    {0x200, 0x200, 0}, {0x201, 0x201, 1}, {0x202, 0x202, 0}, {0x203, 0x203, 1},
+    {0x204, 0x204, 0}, {0x205, 0x205, 1}, {0x206, 0x206, 0}, {0x207, 0x207, 1},
+    {0x208, 0x208, 0}, {0x209, 0x209, 1}, {0x20a, 0x20a, 0}, {0x20b, 0x20b, 1},
+    {0x20c, 0x20c, 0}, {0x20d, 0x20d, 1}, {0x20e, 0x20e, 0}, {0x20f, 0x20f, 1},
+    {0x210, 0x210, 0}, {0x211, 0x211, 1}, {0x212, 0x212, 0}, {0x213, 0x213, 1},
+    {0x214, 0x214, 0}, {0x215, 0x215, 1}, {0x216, 0x216, 0}, {0x217, 0x217, 1},
+    {0x218, 0x218, 0}, {0x219, 0x219, 1}, {0x21a, 0x21a, 0}, {0x21b, 0x21b, 1},
+    {0x21c, 0x21c, 0}, {0x21d, 0x21d, 1}, {0x21e, 0x21e, 0}, {0x21f, 0x21f, 1},
+    {0x220, 0x220, 0}, {0x221, 0x221, 1}, {0x222, 0x222, 0}, {0x223, 0x223, 1},
+    {0x224, 0x224, 0}, {0x225, 0x225, 1}, {0x226, 0x226, 0}, {0x227, 0x227, 1},
+    {0x228, 0x228, 0}, {0x229, 0x229, 1}, {0x22a, 0x22a, 0}, {0x22b, 0x22b, 1},
+    {0x22c, 0x22c, 0}, {0x22d, 0x22d, 1}, {0x22e, 0x22e, 0}, {0x22f, 0x22f, 1},
+    {0x230, 0x230, 0}, {0x231, 0x231, 1}, {0x232, 0x232, 0}, {0x233, 0x239, 1},
+    {0x23a, 0x23b, 0}, {0x23c, 0x23c, 1}, {0x23d, 0x23e, 0}, {0x23f, 0x240, 1},
+    {0x241, 0x241, 0}, {0x242, 0x242, 1}, {0x243, 0x246, 0}, {0x247, 0x247, 1},
+    {0x248, 0x248, 0}, {0x249, 0x249, 1}, {0x24a, 0x24a, 0}, {0x24b, 0x24b, 1},
+    {0x24c, 0x24c, 0}, {0x24d, 0x24d, 1}, {0x24e, 0x24e, 0}, {0x24f, 0x293, 1},
+    {0x294, 0x294, 4}, {0x295, 0x2af, 1}, {0x2b0, 0x2c1, 3}, {0x2c2, 0x2c5, 20},
+    {0x2c6, 0x2d1, 3}, {0x2d2, 0x2df, 20}, {0x2e0, 0x2e4, 3},
+    {0x2e5, 0x2eb, 20}, {0x2ec, 0x2ec, 3}, {0x2ed, 0x2ed, 20},
+    {0x2ee, 0x2ee, 3}, {0x2ef, 0x2ff, 20}, {0x300, 0x36f, 5}, {0x370, 0x370, 0},
+    {0x371, 0x371, 1}, {0x372, 0x372, 0}, {0x373, 0x373, 1}, {0x374, 0x374, 3},
+    {0x375, 0x375, 20}, {0x376, 0x376, 0}, {0x377, 0x377, 1}, {0x37a, 0x37a, 3},
+    {0x37b, 0x37d, 1}, {0x37e, 0x37e, 17}, {0x37f, 0x37f, 0},
+    {0x384, 0x385, 20}, {0x386, 0x386, 0}, {0x387, 0x387, 17},
+    {0x388, 0x38a, 0}, {0x38c, 0x38c, 0}, {0x38e, 0x38f, 0}, {0x390, 0x390, 1},
+    {0x391, 0x3a1, 0}, {0x3a3, 0x3ab, 0}, {0x3ac, 0x3ce, 1}, {0x3cf, 0x3cf, 0},
+    {0x3d0, 0x3d1, 1}, {0x3d2, 0x3d4, 0}, {0x3d5, 0x3d7, 1}, {0x3d8, 0x3d8, 0},
+    {0x3d9, 0x3d9, 1}, {0x3da, 0x3da, 0}, {0x3db, 0x3db, 1}, {0x3dc, 0x3dc, 0},
+    {0x3dd, 0x3dd, 1}, {0x3de, 0x3de, 0}, {0x3df, 0x3df, 1}, {0x3e0, 0x3e0, 0},
+    {0x3e1, 0x3e1, 1}, {0x3e2, 0x3e2, 0}, {0x3e3, 0x3e3, 1}, {0x3e4, 0x3e4, 0},
+    {0x3e5, 0x3e5, 1}, {0x3e6, 0x3e6, 0}, {0x3e7, 0x3e7, 1}, {0x3e8, 0x3e8, 0},
+    {0x3e9, 0x3e9, 1}, {0x3ea, 0x3ea, 0}, {0x3eb, 0x3eb, 1}, {0x3ec, 0x3ec, 0},
+    {0x3ed, 0x3ed, 1}, {0x3ee, 0x3ee, 0}, {0x3ef, 0x3f3, 1}, {0x3f4, 0x3f4, 0},
+    {0x3f5, 0x3f5, 1}, {0x3f6, 0x3f6, 18}, {0x3f7, 0x3f7, 0}, {0x3f8, 0x3f8, 1},
+    {0x3f9, 0x3fa, 0}, {0x3fb, 0x3fc, 1}, {0x3fd, 0x42f, 0}, {0x430, 0x45f, 1},
+    {0x460, 0x460, 0}, {0x461, 0x461, 1}, {0x462, 0x462, 0}, {0x463, 0x463, 1},
+    {0x464, 0x464, 0}, {0x465, 0x465, 1}, {0x466, 0x466, 0}, {0x467, 0x467, 1},
+    {0x468, 0x468, 0}, {0x469, 0x469, 1}, {0x46a, 0x46a, 0}, {0x46b, 0x46b, 1},
+    {0x46c, 0x46c, 0}, {0x46d, 0x46d, 1}, {0x46e, 0x46e, 0}, {0x46f, 0x46f, 1},
+    {0x470, 0x470, 0}, {0x471, 0x471, 1}, {0x472, 0x472, 0}, {0x473, 0x473, 1},
+    {0x474, 0x474, 0}, {0x475, 0x475, 1}, {0x476, 0x476, 0}, {0x477, 0x477, 1},
+    {0x478, 0x478, 0}, {0x479, 0x479, 1}, {0x47a, 0x47a, 0}, {0x47b, 0x47b, 1},
+    {0x47c, 0x47c, 0}, {0x47d, 0x47d, 1}, {0x47e, 0x47e, 0}, {0x47f, 0x47f, 1},
+    {0x480, 0x480, 0}, {0x481, 0x481, 1}, {0x482, 0x482, 21}, {0x483, 0x487, 5},
+    {0x488, 0x489, 7}, {0x48a, 0x48a, 0}, {0x48b, 0x48b, 1}, {0x48c, 0x48c, 0},
+    {0x48d, 0x48d, 1}, {0x48e, 0x48e, 0}, {0x48f, 0x48f, 1}, {0x490, 0x490, 0},
+    {0x491, 0x491, 1}, {0x492, 0x492, 0}, {0x493, 0x493, 1}, {0x494, 0x494, 0},
+    {0x495, 0x495, 1}, {0x496, 0x496, 0}, {0x497, 0x497, 1}, {0x498, 0x498, 0},
+    {0x499, 0x499, 1}, {0x49a, 0x49a, 0}, {0x49b, 0x49b, 1}, {0x49c, 0x49c, 0},
+    {0x49d, 0x49d, 1}, {0x49e, 0x49e, 0}, {0x49f, 0x49f, 1}, {0x4a0, 0x4a0, 0},
+    {0x4a1, 0x4a1, 1}, {0x4a2, 0x4a2, 0}, {0x4a3, 0x4a3, 1}, {0x4a4, 0x4a4, 0},
+    {0x4a5, 0x4a5, 1}, {0x4a6, 0x4a6, 0}, {0x4a7, 0x4a7, 1}, {0x4a8, 0x4a8, 0},
+    {0x4a9, 0x4a9, 1}, {0x4aa, 0x4aa, 0}, {0x4ab, 0x4ab, 1}, {0x4ac, 0x4ac, 0},
+    {0x4ad, 0x4ad, 1}, {0x4ae, 0x4ae, 0}, {0x4af, 0x4af, 1}, {0x4b0, 0x4b0, 0},
+    {0x4b1, 0x4b1, 1}, {0x4b2, 0x4b2, 0}, {0x4b3, 0x4b3, 1}, {0x4b4, 0x4b4, 0},
+    {0x4b5, 0x4b5, 1}, {0x4b6, 0x4b6, 0}, {0x4b7, 0x4b7, 1}, {0x4b8, 0x4b8, 0},
+    {0x4b9, 0x4b9, 1}, {0x4ba, 0x4ba, 0}, {0x4bb, 0x4bb, 1}, {0x4bc, 0x4bc, 0},
+    {0x4bd, 0x4bd, 1}, {0x4be, 0x4be, 0}, {0x4bf, 0x4bf, 1}, {0x4c0, 0x4c1, 0},
+    {0x4c2, 0x4c2, 1}, {0x4c3, 0x4c3, 0}, {0x4c4, 0x4c4, 1}, {0x4c5, 0x4c5, 0},
+    {0x4c6, 0x4c6, 1}, {0x4c7, 0x4c7, 0}, {0x4c8, 0x4c8, 1}, {0x4c9, 0x4c9, 0},
+    {0x4ca, 0x4ca, 1}, {0x4cb, 0x4cb, 0}, {0x4cc, 0x4cc, 1}, {0x4cd, 0x4cd, 0},
+    {0x4ce, 0x4cf, 1}, {0x4d0, 0x4d0, 0}, {0x4d1, 0x4d1, 1}, {0x4d2, 0x4d2, 0},
+    {0x4d3, 0x4d3, 1}, {0x4d4, 0x4d4, 0}, {0x4d5, 0x4d5, 1}, {0x4d6, 0x4d6, 0},
+    {0x4d7, 0x4d7, 1}, {0x4d8, 0x4d8, 0}, {0x4d9, 0x4d9, 1}, {0x4da, 0x4da, 0},
+    {0x4db, 0x4db, 1}, {0x4dc, 0x4dc, 0}, {0x4dd, 0x4dd, 1}, {0x4de, 0x4de, 0},
+    {0x4df, 0x4df, 1}, {0x4e0, 0x4e0, 0}, {0x4e1, 0x4e1, 1}, {0x4e2, 0x4e2, 0},
+    {0x4e3, 0x4e3, 1}, {0x4e4, 0x4e4, 0}, {0x4e5, 0x4e5, 1}, {0x4e6, 0x4e6, 0},
+    {0x4e7, 0x4e7, 1}, {0x4e8, 0x4e8, 0}, {0x4e9, 0x4e9, 1}, {0x4ea, 0x4ea, 0},
+    {0x4eb, 0x4eb, 1}, {0x4ec, 0x4ec, 0}, {0x4ed, 0x4ed, 1}, {0x4ee, 0x4ee, 0},
+    {0x4ef, 0x4ef, 1}, {0x4f0, 0x4f0, 0}, {0x4f1, 0x4f1, 1}, {0x4f2, 0x4f2, 0},
+    {0x4f3, 0x4f3, 1}, {0x4f4, 0x4f4, 0}, {0x4f5, 0x4f5, 1}, {0x4f6, 0x4f6, 0},
+    {0x4f7, 0x4f7, 1}, {0x4f8, 0x4f8, 0}, {0x4f9, 0x4f9, 1}, {0x4fa, 0x4fa, 0},
+    {0x4fb, 0x4fb, 1}, {0x4fc, 0x4fc, 0}, {0x4fd, 0x4fd, 1}, {0x4fe, 0x4fe, 0},
+    {0x4ff, 0x4ff, 1}, {0x500, 0x500, 0}, {0x501, 0x501, 1}, {0x502, 0x502, 0},
+    {0x503, 0x503, 1}, {0x504, 0x504, 0}, {0x505, 0x505, 1}, {0x506, 0x506, 0},
+    {0x507, 0x507, 1}, {0x508, 0x508, 0}, {0x509, 0x509, 1}, {0x50a, 0x50a, 0},
+    {0x50b, 0x50b, 1}, {0x50c, 0x50c, 0}, {0x50d, 0x50d, 1}, {0x50e, 0x50e, 0},
+    {0x50f, 0x50f, 1}, {0x510, 0x510, 0}, {0x511, 0x511, 1}, {0x512, 0x512, 0},
+    {0x513, 0x513, 1}, {0x514, 0x514, 0}, {0x515, 0x515, 1}, {0x516, 0x516, 0},
+    {0x517, 0x517, 1}, {0x518, 0x518, 0}, {0x519, 0x519, 1}, {0x51a, 0x51a, 0},
+    {0x51b, 0x51b, 1}, {0x51c, 0x51c, 0}, {0x51d, 0x51d, 1}, {0x51e, 0x51e, 0},
+    {0x51f, 0x51f, 1}, {0x520, 0x520, 0}, {0x521, 0x521, 1}, {0x522, 0x522, 0},
+    {0x523, 0x523, 1}, {0x524, 0x524, 0}, {0x525, 0x525, 1}, {0x526, 0x526, 0},
+    {0x527, 0x527, 1}, {0x528, 0x528, 0}, {0x529, 0x529, 1}, {0x52a, 0x52a, 0},
+    {0x52b, 0x52b, 1}, {0x52c, 0x52c, 0}, {0x52d, 0x52d, 1}, {0x52e, 0x52e, 0},
+    {0x52f, 0x52f, 1}, {0x531, 0x556, 0}, {0x559, 0x559, 3}, {0x55a, 0x55f, 17},
+    {0x560, 0x588, 1}, {0x589, 0x589, 17}, {0x58a, 0x58a, 12},
+    {0x58d, 0x58e, 21}, {0x58f, 0x58f, 19}, {0x591, 0x5bd, 5},
+    {0x5be, 0x5be, 12}, {0x5bf, 0x5bf, 5}, {0x5c0, 0x5c0, 17},
+    {0x5c1, 0x5c2, 5}, {0x5c3, 0x5c3, 17}, {0x5c4, 0x5c5, 5},
+    {0x5c6, 0x5c6, 17}, {0x5c7, 0x5c7, 5}, {0x5d0, 0x5ea, 4}, {0x5ef, 0x5f2, 4},
+    {0x5f3, 0x5f4, 17}, {0x600, 0x605, 26}, {0x606, 0x608, 18},
+    {0x609, 0x60a, 17}, {0x60b, 0x60b, 19}, {0x60c, 0x60d, 17},
+    {0x60e, 0x60f, 21}, {0x610, 0x61a, 5}, {0x61b, 0x61b, 17},
+    {0x61c, 0x61c, 26}, {0x61d, 0x61f, 17}, {0x620, 0x63f, 4},
+    {0x640, 0x640, 3}, {0x641, 0x64a, 4}, {0x64b, 0x65f, 5}, {0x660, 0x669, 8},
+    {0x66a, 0x66d, 17}, {0x66e, 0x66f, 4}, {0x670, 0x670, 5}, {0x671, 0x6d3, 4},
+    {0x6d4, 0x6d4, 17}, {0x6d5, 0x6d5, 4}, {0x6d6, 0x6dc, 5},
+    {0x6dd, 0x6dd, 26}, {0x6de, 0x6de, 21}, {0x6df, 0x6e4, 5},
+    {0x6e5, 0x6e6, 3}, {0x6e7, 0x6e8, 5}, {0x6e9, 0x6e9, 21}, {0x6ea, 0x6ed, 5},
+    {0x6ee, 0x6ef, 4}, {0x6f0, 0x6f9, 8}, {0x6fa, 0x6fc, 4}, {0x6fd, 0x6fe, 21},
+    {0x6ff, 0x6ff, 4}, {0x700, 0x70d, 17}, {0x70f, 0x70f, 26},
+    {0x710, 0x710, 4}, {0x711, 0x711, 5}, {0x712, 0x72f, 4}, {0x730, 0x74a, 5},
+    {0x74d, 0x7a5, 4}, {0x7a6, 0x7b0, 5}, {0x7b1, 0x7b1, 4}, {0x7c0, 0x7c9, 8},
+    {0x7ca, 0x7ea, 4}, {0x7eb, 0x7f3, 5}, {0x7f4, 0x7f5, 3}, {0x7f6, 0x7f6, 21},
+    {0x7f7, 0x7f9, 17}, {0x7fa, 0x7fa, 3}, {0x7fd, 0x7fd, 5},
+    {0x7fe, 0x7ff, 19}, {0x800, 0x815, 4}, {0x816, 0x819, 5}, {0x81a, 0x81a, 3},
+    {0x81b, 0x823, 5}, {0x824, 0x824, 3}, {0x825, 0x827, 5}, {0x828, 0x828, 3},
+    {0x829, 0x82d, 5}, {0x830, 0x83e, 17}, {0x840, 0x858, 4}, {0x859, 0x85b, 5},
+    {0x85e, 0x85e, 17}, {0x860, 0x86a, 4}, {0x870, 0x887, 4},
+    {0x888, 0x888, 20}, {0x889, 0x88e, 4}, {0x890, 0x891, 26},
+    {0x898, 0x89f, 5}, {0x8a0, 0x8c8, 4}, {0x8c9, 0x8c9, 3}, {0x8ca, 0x8e1, 5},
+    {0x8e2, 0x8e2, 26}, {0x8e3, 0x902, 5}, {0x903, 0x903, 6}, {0x904, 0x939, 4},
+    {0x93a, 0x93a, 5}, {0x93b, 0x93b, 6}, {0x93c, 0x93c, 5}, {0x93d, 0x93d, 4},
+    {0x93e, 0x940, 6}, {0x941, 0x948, 5}, {0x949, 0x94c, 6}, {0x94d, 0x94d, 5},
+    {0x94e, 0x94f, 6}, {0x950, 0x950, 4}, {0x951, 0x957, 5}, {0x958, 0x961, 4},
+    {0x962, 0x963, 5}, {0x964, 0x965, 17}, {0x966, 0x96f, 8},
+    {0x970, 0x970, 17}, {0x971, 0x971, 3}, {0x972, 0x980, 4}, {0x981, 0x981, 5},
+    {0x982, 0x983, 6}, {0x985, 0x98c, 4}, {0x98f, 0x990, 4}, {0x993, 0x9a8, 4},
+    {0x9aa, 0x9b0, 4}, {0x9b2, 0x9b2, 4}, {0x9b6, 0x9b9, 4}, {0x9bc, 0x9bc, 5},
+    {0x9bd, 0x9bd, 4}, {0x9be, 0x9c0, 6}, {0x9c1, 0x9c4, 5}, {0x9c7, 0x9c8, 6},
+    {0x9cb, 0x9cc, 6}, {0x9cd, 0x9cd, 5}, {0x9ce, 0x9ce, 4}, {0x9d7, 0x9d7, 6},
+    {0x9dc, 0x9dd, 4}, {0x9df, 0x9e1, 4}, {0x9e2, 0x9e3, 5}, {0x9e6, 0x9ef, 8},
+    {0x9f0, 0x9f1, 4}, {0x9f2, 0x9f3, 19}, {0x9f4, 0x9f9, 10},
+    {0x9fa, 0x9fa, 21}, {0x9fb, 0x9fb, 19}, {0x9fc, 0x9fc, 4},
+    {0x9fd, 0x9fd, 17}, {0x9fe, 0x9fe, 5}, {0xa01, 0xa02, 5}, {0xa03, 0xa03, 6},
+    {0xa05, 0xa0a, 4}, {0xa0f, 0xa10, 4}, {0xa13, 0xa28, 4}, {0xa2a, 0xa30, 4},
+    {0xa32, 0xa33, 4}, {0xa35, 0xa36, 4}, {0xa38, 0xa39, 4}, {0xa3c, 0xa3c, 5},
+    {0xa3e, 0xa40, 6}, {0xa41, 0xa42, 5}, {0xa47, 0xa48, 5}, {0xa4b, 0xa4d, 5},
+    {0xa51, 0xa51, 5}, {0xa59, 0xa5c, 4}, {0xa5e, 0xa5e, 4}, {0xa66, 0xa6f, 8},
+    {0xa70, 0xa71, 5}, {0xa72, 0xa74, 4}, {0xa75, 0xa75, 5}, {0xa76, 0xa76, 17},
+    {0xa81, 0xa82, 5}, {0xa83, 0xa83, 6}, {0xa85, 0xa8d, 4}, {0xa8f, 0xa91, 4},
+    {0xa93, 0xaa8, 4}, {0xaaa, 0xab0, 4}, {0xab2, 0xab3, 4}, {0xab5, 0xab9, 4},
+    {0xabc, 0xabc, 5}, {0xabd, 0xabd, 4}, {0xabe, 0xac0, 6}, {0xac1, 0xac5, 5},
+    {0xac7, 0xac8, 5}, {0xac9, 0xac9, 6}, {0xacb, 0xacc, 6}, {0xacd, 0xacd, 5},
+    {0xad0, 0xad0, 4}, {0xae0, 0xae1, 4}, {0xae2, 0xae3, 5}, {0xae6, 0xaef, 8},
+    {0xaf0, 0xaf0, 17}, {0xaf1, 0xaf1, 19}, {0xaf9, 0xaf9, 4},
+    {0xafa, 0xaff, 5}, {0xb01, 0xb01, 5}, {0xb02, 0xb03, 6}, {0xb05, 0xb0c, 4},
+    {0xb0f, 0xb10, 4}, {0xb13, 0xb28, 4}, {0xb2a, 0xb30, 4}, {0xb32, 0xb33, 4},
+    {0xb35, 0xb39, 4}, {0xb3c, 0xb3c, 5}, {0xb3d, 0xb3d, 4}, {0xb3e, 0xb3e, 6},
+    {0xb3f, 0xb3f, 5}, {0xb40, 0xb40, 6}, {0xb41, 0xb44, 5}, {0xb47, 0xb48, 6},
+    {0xb4b, 0xb4c, 6}, {0xb4d, 0xb4d, 5}, {0xb55, 0xb56, 5}, {0xb57, 0xb57, 6},
+    {0xb5c, 0xb5d, 4}, {0xb5f, 0xb61, 4}, {0xb62, 0xb63, 5}, {0xb66, 0xb6f, 8},
+    {0xb70, 0xb70, 21}, {0xb71, 0xb71, 4}, {0xb72, 0xb77, 10},
+    {0xb82, 0xb82, 5}, {0xb83, 0xb83, 4}, {0xb85, 0xb8a, 4}, {0xb8e, 0xb90, 4},
+    {0xb92, 0xb95, 4}, {0xb99, 0xb9a, 4}, {0xb9c, 0xb9c, 4}, {0xb9e, 0xb9f, 4},
+    {0xba3, 0xba4, 4}, {0xba8, 0xbaa, 4}, {0xbae, 0xbb9, 4}, {0xbbe, 0xbbf, 6},
+    {0xbc0, 0xbc0, 5}, {0xbc1, 0xbc2, 6}, {0xbc6, 0xbc8, 6}, {0xbca, 0xbcc, 6},
+    {0xbcd, 0xbcd, 5}, {0xbd0, 0xbd0, 4}, {0xbd7, 0xbd7, 6}, {0xbe6, 0xbef, 8},
+    {0xbf0, 0xbf2, 10}, {0xbf3, 0xbf8, 21}, {0xbf9, 0xbf9, 19},
+    {0xbfa, 0xbfa, 21}, {0xc00, 0xc00, 5}, {0xc01, 0xc03, 6}, {0xc04, 0xc04, 5},
+    {0xc05, 0xc0c, 4}, {0xc0e, 0xc10, 4}, {0xc12, 0xc28, 4}, {0xc2a, 0xc39, 4},
+    {0xc3c, 0xc3c, 5}, {0xc3d, 0xc3d, 4}, {0xc3e, 0xc40, 5}, {0xc41, 0xc44, 6},
+    {0xc46, 0xc48, 5}, {0xc4a, 0xc4d, 5}, {0xc55, 0xc56, 5}, {0xc58, 0xc5a, 4},
+    {0xc5d, 0xc5d, 4}, {0xc60, 0xc61, 4}, {0xc62, 0xc63, 5}, {0xc66, 0xc6f, 8},
+    {0xc77, 0xc77, 17}, {0xc78, 0xc7e, 10}, {0xc7f, 0xc7f, 21},
+    {0xc80, 0xc80, 4}, {0xc81, 0xc81, 5}, {0xc82, 0xc83, 6}, {0xc84, 0xc84, 17},
+    {0xc85, 0xc8c, 4}, {0xc8e, 0xc90, 4}, {0xc92, 0xca8, 4}, {0xcaa, 0xcb3, 4},
+    {0xcb5, 0xcb9, 4}, {0xcbc, 0xcbc, 5}, {0xcbd, 0xcbd, 4}, {0xcbe, 0xcbe, 6},
+    {0xcbf, 0xcbf, 5}, {0xcc0, 0xcc4, 6}, {0xcc6, 0xcc6, 5}, {0xcc7, 0xcc8, 6},
+    {0xcca, 0xccb, 6}, {0xccc, 0xccd, 5}, {0xcd5, 0xcd6, 6}, {0xcdd, 0xcde, 4},
+    {0xce0, 0xce1, 4}, {0xce2, 0xce3, 5}, {0xce6, 0xcef, 8}, {0xcf1, 0xcf2, 4},
+    {0xd00, 0xd01, 5}, {0xd02, 0xd03, 6}, {0xd04, 0xd0c, 4}, {0xd0e, 0xd10, 4},
+    {0xd12, 0xd3a, 4}, {0xd3b, 0xd3c, 5}, {0xd3d, 0xd3d, 4}, {0xd3e, 0xd40, 6},
+    {0xd41, 0xd44, 5}, {0xd46, 0xd48, 6}, {0xd4a, 0xd4c, 6}, {0xd4d, 0xd4d, 5},
+    {0xd4e, 0xd4e, 4}, {0xd4f, 0xd4f, 21}, {0xd54, 0xd56, 4}, {0xd57, 0xd57, 6},
+    {0xd58, 0xd5e, 10}, {0xd5f, 0xd61, 4}, {0xd62, 0xd63, 5}, {0xd66, 0xd6f, 8},
+    {0xd70, 0xd78, 10}, {0xd79, 0xd79, 21}, {0xd7a, 0xd7f, 4},
+    {0xd81, 0xd81, 5}, {0xd82, 0xd83, 6}, {0xd85, 0xd96, 4}, {0xd9a, 0xdb1, 4},
+    {0xdb3, 0xdbb, 4}, {0xdbd, 0xdbd, 4}, {0xdc0, 0xdc6, 4}, {0xdca, 0xdca, 5},
+    {0xdcf, 0xdd1, 6}, {0xdd2, 0xdd4, 5}, {0xdd6, 0xdd6, 5}, {0xdd8, 0xddf, 6},
+    {0xde6, 0xdef, 8}, {0xdf2, 0xdf3, 6}, {0xdf4, 0xdf4, 17}, {0xe01, 0xe30, 4},
+    {0xe31, 0xe31, 5}, {0xe32, 0xe33, 4}, {0xe34, 0xe3a, 5}, {0xe3f, 0xe3f, 19},
+    {0xe40, 0xe45, 4}, {0xe46, 0xe46, 3}, {0xe47, 0xe4e, 5}, {0xe4f, 0xe4f, 17},
+    {0xe50, 0xe59, 8}, {0xe5a, 0xe5b, 17}, {0xe81, 0xe82, 4}, {0xe84, 0xe84, 4},
+    {0xe86, 0xe8a, 4}, {0xe8c, 0xea3, 4}, {0xea5, 0xea5, 4}, {0xea7, 0xeb0, 4},
+    {0xeb1, 0xeb1, 5}, {0xeb2, 0xeb3, 4}, {0xeb4, 0xebc, 5}, {0xebd, 0xebd, 4},
+    {0xec0, 0xec4, 4}, {0xec6, 0xec6, 3}, {0xec8, 0xecd, 5}, {0xed0, 0xed9, 8},
+    {0xedc, 0xedf, 4}, {0xf00, 0xf00, 4}, {0xf01, 0xf03, 21},
+    {0xf04, 0xf12, 17}, {0xf13, 0xf13, 21}, {0xf14, 0xf14, 17},
+    {0xf15, 0xf17, 21}, {0xf18, 0xf19, 5}, {0xf1a, 0xf1f, 21},
+    {0xf20, 0xf29, 8}, {0xf2a, 0xf33, 10}, {0xf34, 0xf34, 21},
+    {0xf35, 0xf35, 5}, {0xf36, 0xf36, 21}, {0xf37, 0xf37, 5},
+    {0xf38, 0xf38, 21}, {0xf39, 0xf39, 5}, {0xf3a, 0xf3a, 13},
+    {0xf3b, 0xf3b, 14}, {0xf3c, 0xf3c, 13}, {0xf3d, 0xf3d, 14},
+    {0xf3e, 0xf3f, 6}, {0xf40, 0xf47, 4}, {0xf49, 0xf6c, 4}, {0xf71, 0xf7e, 5},
+    {0xf7f, 0xf7f, 6}, {0xf80, 0xf84, 5}, {0xf85, 0xf85, 17}, {0xf86, 0xf87, 5},
+    {0xf88, 0xf8c, 4}, {0xf8d, 0xf97, 5}, {0xf99, 0xfbc, 5}, {0xfbe, 0xfc5, 21},
+    {0xfc6, 0xfc6, 5}, {0xfc7, 0xfcc, 21}, {0xfce, 0xfcf, 21},
+    {0xfd0, 0xfd4, 17}, {0xfd5, 0xfd8, 21}, {0xfd9, 0xfda, 17},
+    {0x1000, 0x102a, 4}, {0x102b, 0x102c, 6}, {0x102d, 0x1030, 5},
+    {0x1031, 0x1031, 6}, {0x1032, 0x1037, 5}, {0x1038, 0x1038, 6},
+    {0x1039, 0x103a, 5}, {0x103b, 0x103c, 6}, {0x103d, 0x103e, 5},
+    {0x103f, 0x103f, 4}, {0x1040, 0x1049, 8}, {0x104a, 0x104f, 17},
+    {0x1050, 0x1055, 4}, {0x1056, 0x1057, 6}, {0x1058, 0x1059, 5},
+    {0x105a, 0x105d, 4}, {0x105e, 0x1060, 5}, {0x1061, 0x1061, 4},
+    {0x1062, 0x1064, 6}, {0x1065, 0x1066, 4}, {0x1067, 0x106d, 6},
+    {0x106e, 0x1070, 4}, {0x1071, 0x1074, 5}, {0x1075, 0x1081, 4},
+    {0x1082, 0x1082, 5}, {0x1083, 0x1084, 6}, {0x1085, 0x1086, 5},
+    {0x1087, 0x108c, 6}, {0x108d, 0x108d, 5}, {0x108e, 0x108e, 4},
+    {0x108f, 0x108f, 6}, {0x1090, 0x1099, 8}, {0x109a, 0x109c, 6},
+    {0x109d, 0x109d, 5}, {0x109e, 0x109f, 21}, {0x10a0, 0x10c5, 0},
+    {0x10c7, 0x10c7, 0}, {0x10cd, 0x10cd, 0}, {0x10d0, 0x10fa, 1},
+    {0x10fb, 0x10fb, 17}, {0x10fc, 0x10fc, 3}, {0x10fd, 0x10ff, 1},
+    {0x1100, 0x1248, 4}, {0x124a, 0x124d, 4}, {0x1250, 0x1256, 4},
+    {0x1258, 0x1258, 4}, {0x125a, 0x125d, 4}, {0x1260, 0x1288, 4},
+    {0x128a, 0x128d, 4}, {0x1290, 0x12b0, 4}, {0x12b2, 0x12b5, 4},
+    {0x12b8, 0x12be, 4}, {0x12c0, 0x12c0, 4}, {0x12c2, 0x12c5, 4},
+    {0x12c8, 0x12d6, 4}, {0x12d8, 0x1310, 4}, {0x1312, 0x1315, 4},
+    {0x1318, 0x135a, 4}, {0x135d, 0x135f, 5}, {0x1360, 0x1368, 17},
+    {0x1369, 0x137c, 10}, {0x1380, 0x138f, 4}, {0x1390, 0x1399, 21},
+    {0x13a0, 0x13f5, 0}, {0x13f8, 0x13fd, 1}, {0x1400, 0x1400, 12},
+    {0x1401, 0x166c, 4}, {0x166d, 0x166d, 21}, {0x166e, 0x166e, 17},
+    {0x166f, 0x167f, 4}, {0x1680, 0x1680, 22}, {0x1681, 0x169a, 4},
+    {0x169b, 0x169b, 13}, {0x169c, 0x169c, 14}, {0x16a0, 0x16ea, 4},
+    {0x16eb, 0x16ed, 17}, {0x16ee, 0x16f0, 9}, {0x16f1, 0x16f8, 4},
+    {0x1700, 0x1711, 4}, {0x1712, 0x1714, 5}, {0x1715, 0x1715, 6},
+    {0x171f, 0x1731, 4}, {0x1732, 0x1733, 5}, {0x1734, 0x1734, 6},
+    {0x1735, 0x1736, 17}, {0x1740, 0x1751, 4}, {0x1752, 0x1753, 5},
+    {0x1760, 0x176c, 4}, {0x176e, 0x1770, 4}, {0x1772, 0x1773, 5},
+    {0x1780, 0x17b3, 4}, {0x17b4, 0x17b5, 5}, {0x17b6, 0x17b6, 6},
+    {0x17b7, 0x17bd, 5}, {0x17be, 0x17c5, 6}, {0x17c6, 0x17c6, 5},
+    {0x17c7, 0x17c8, 6}, {0x17c9, 0x17d3, 5}, {0x17d4, 0x17d6, 17},
+    {0x17d7, 0x17d7, 3}, {0x17d8, 0x17da, 17}, {0x17db, 0x17db, 19},
+    {0x17dc, 0x17dc, 4}, {0x17dd, 0x17dd, 5}, {0x17e0, 0x17e9, 8},
+    {0x17f0, 0x17f9, 10}, {0x1800, 0x1805, 17}, {0x1806, 0x1806, 12},
+    {0x1807, 0x180a, 17}, {0x180b, 0x180d, 5}, {0x180e, 0x180e, 26},
+    {0x180f, 0x180f, 5}, {0x1810, 0x1819, 8}, {0x1820, 0x1842, 4},
+    {0x1843, 0x1843, 3}, {0x1844, 0x1878, 4}, {0x1880, 0x1884, 4},
+    {0x1885, 0x1886, 5}, {0x1887, 0x18a8, 4}, {0x18a9, 0x18a9, 5},
+    {0x18aa, 0x18aa, 4}, {0x18b0, 0x18f5, 4}, {0x1900, 0x191e, 4},
+    {0x1920, 0x1922, 5}, {0x1923, 0x1926, 6}, {0x1927, 0x1928, 5},
+    {0x1929, 0x192b, 6}, {0x1930, 0x1931, 6}, {0x1932, 0x1932, 5},
+    {0x1933, 0x1938, 6}, {0x1939, 0x193b, 5}, {0x1940, 0x1940, 21},
+    {0x1944, 0x1945, 17}, {0x1946, 0x194f, 8}, {0x1950, 0x196d, 4},
+    {0x1970, 0x1974, 4}, {0x1980, 0x19ab, 4}, {0x19b0, 0x19c9, 4},
+    {0x19d0, 0x19d9, 8}, {0x19da, 0x19da, 10}, {0x19de, 0x19ff, 21},
+    {0x1a00, 0x1a16, 4}, {0x1a17, 0x1a18, 5}, {0x1a19, 0x1a1a, 6},
+    {0x1a1b, 0x1a1b, 5}, {0x1a1e, 0x1a1f, 17}, {0x1a20, 0x1a54, 4},
+    {0x1a55, 0x1a55, 6}, {0x1a56, 0x1a56, 5}, {0x1a57, 0x1a57, 6},
+    {0x1a58, 0x1a5e, 5}, {0x1a60, 0x1a60, 5}, {0x1a61, 0x1a61, 6},
+    {0x1a62, 0x1a62, 5}, {0x1a63, 0x1a64, 6}, {0x1a65, 0x1a6c, 5},
+    {0x1a6d, 0x1a72, 6}, {0x1a73, 0x1a7c, 5}, {0x1a7f, 0x1a7f, 5},
+    {0x1a80, 0x1a89, 8}, {0x1a90, 0x1a99, 8}, {0x1aa0, 0x1aa6, 17},
+    {0x1aa7, 0x1aa7, 3}, {0x1aa8, 0x1aad, 17}, {0x1ab0, 0x1abd, 5},
+    {0x1abe, 0x1abe, 7}, {0x1abf, 0x1ace, 5}, {0x1b00, 0x1b03, 5},
+    {0x1b04, 0x1b04, 6}, {0x1b05, 0x1b33, 4}, {0x1b34, 0x1b34, 5},
+    {0x1b35, 0x1b35, 6}, {0x1b36, 0x1b3a, 5}, {0x1b3b, 0x1b3b, 6},
+    {0x1b3c, 0x1b3c, 5}, {0x1b3d, 0x1b41, 6}, {0x1b42, 0x1b42, 5},
+    {0x1b43, 0x1b44, 6}, {0x1b45, 0x1b4c, 4}, {0x1b50, 0x1b59, 8},
+    {0x1b5a, 0x1b60, 17}, {0x1b61, 0x1b6a, 21}, {0x1b6b, 0x1b73, 5},
+    {0x1b74, 0x1b7c, 21}, {0x1b7d, 0x1b7e, 17}, {0x1b80, 0x1b81, 5},
+    {0x1b82, 0x1b82, 6}, {0x1b83, 0x1ba0, 4}, {0x1ba1, 0x1ba1, 6},
+    {0x1ba2, 0x1ba5, 5}, {0x1ba6, 0x1ba7, 6}, {0x1ba8, 0x1ba9, 5},
+    {0x1baa, 0x1baa, 6}, {0x1bab, 0x1bad, 5}, {0x1bae, 0x1baf, 4},
+    {0x1bb0, 0x1bb9, 8}, {0x1bba, 0x1be5, 4}, {0x1be6, 0x1be6, 5},
+    {0x1be7, 0x1be7, 6}, {0x1be8, 0x1be9, 5}, {0x1bea, 0x1bec, 6},
+    {0x1bed, 0x1bed, 5}, {0x1bee, 0x1bee, 6}, {0x1bef, 0x1bf1, 5},
+    {0x1bf2, 0x1bf3, 6}, {0x1bfc, 0x1bff, 17}, {0x1c00, 0x1c23, 4},
+    {0x1c24, 0x1c2b, 6}, {0x1c2c, 0x1c33, 5}, {0x1c34, 0x1c35, 6},
+    {0x1c36, 0x1c37, 5}, {0x1c3b, 0x1c3f, 17}, {0x1c40, 0x1c49, 8},
+    {0x1c4d, 0x1c4f, 4}, {0x1c50, 0x1c59, 8}, {0x1c5a, 0x1c77, 4},
+    {0x1c78, 0x1c7d, 3}, {0x1c7e, 0x1c7f, 17}, {0x1c80, 0x1c88, 1},
+    {0x1c90, 0x1cba, 0}, {0x1cbd, 0x1cbf, 0}, {0x1cc0, 0x1cc7, 17},
+    {0x1cd0, 0x1cd2, 5}, {0x1cd3, 0x1cd3, 17}, {0x1cd4, 0x1ce0, 5},
+    {0x1ce1, 0x1ce1, 6}, {0x1ce2, 0x1ce8, 5}, {0x1ce9, 0x1cec, 4},
+    {0x1ced, 0x1ced, 5}, {0x1cee, 0x1cf3, 4}, {0x1cf4, 0x1cf4, 5},
+    {0x1cf5, 0x1cf6, 4}, {0x1cf7, 0x1cf7, 6}, {0x1cf8, 0x1cf9, 5},
+    {0x1cfa, 0x1cfa, 4}, {0x1d00, 0x1d2b, 1}, {0x1d2c, 0x1d6a, 3},
+    {0x1d6b, 0x1d77, 1}, {0x1d78, 0x1d78, 3}, {0x1d79, 0x1d9a, 1},
+    {0x1d9b, 0x1dbf, 3}, {0x1dc0, 0x1dff, 5}, {0x1e00, 0x1e00, 0},
+    {0x1e01, 0x1e01, 1}, {0x1e02, 0x1e02, 0}, {0x1e03, 0x1e03, 1},
+    {0x1e04, 0x1e04, 0}, {0x1e05, 0x1e05, 1}, {0x1e06, 0x1e06, 0},
+    {0x1e07, 0x1e07, 1}, {0x1e08, 0x1e08, 0}, {0x1e09, 0x1e09, 1},
+    {0x1e0a, 0x1e0a, 0}, {0x1e0b, 0x1e0b, 1}, {0x1e0c, 0x1e0c, 0},
+    {0x1e0d, 0x1e0d, 1}, {0x1e0e, 0x1e0e, 0}, {0x1e0f, 0x1e0f, 1},
+    {0x1e10, 0x1e10, 0}, {0x1e11, 0x1e11, 1}, {0x1e12, 0x1e12, 0},
+    {0x1e13, 0x1e13, 1}, {0x1e14, 0x1e14, 0}, {0x1e15, 0x1e15, 1},
+    {0x1e16, 0x1e16, 0}, {0x1e17, 0x1e17, 1}, {0x1e18, 0x1e18, 0},
+    {0x1e19, 0x1e19, 1}, {0x1e1a, 0x1e1a, 0}, {0x1e1b, 0x1e1b, 1},
+    {0x1e1c, 0x1e1c, 0}, {0x1e1d, 0x1e1d, 1}, {0x1e1e, 0x1e1e, 0},
+    {0x1e1f, 0x1e1f, 1}, {0x1e20, 0x1e20, 0}, {0x1e21, 0x1e21, 1},
+    {0x1e22, 0x1e22, 0}, {0x1e23, 0x1e23, 1}, {0x1e24, 0x1e24, 0},
+    {0x1e25, 0x1e25, 1}, {0x1e26, 0x1e26, 0}, {0x1e27, 0x1e27, 1},
+    {0x1e28, 0x1e28, 0}, {0x1e29, 0x1e29, 1}, {0x1e2a, 0x1e2a, 0},
+    {0x1e2b, 0x1e2b, 1}, {0x1e2c, 0x1e2c, 0}, {0x1e2d, 0x1e2d, 1},
+    {0x1e2e, 0x1e2e, 0}, {0x1e2f, 0x1e2f, 1}, {0x1e30, 0x1e30, 0},
+    {0x1e31, 0x1e31, 1}, {0x1e32, 0x1e32, 0}, {0x1e33, 0x1e33, 1},
+    {0x1e34, 0x1e34, 0}, {0x1e35, 0x1e35, 1}, {0x1e36, 0x1e36, 0},
+    {0x1e37, 0x1e37, 1}, {0x1e38, 0x1e38, 0}, {0x1e39, 0x1e39, 1},
+    {0x1e3a, 0x1e3a, 0}, {0x1e3b, 0x1e3b, 1}, {0x1e3c, 0x1e3c, 0},
+    {0x1e3d, 0x1e3d, 1}, {0x1e3e, 0x1e3e, 0}, {0x1e3f, 0x1e3f, 1},
+    {0x1e40, 0x1e40, 0}, {0x1e41, 0x1e41, 1}, {0x1e42, 0x1e42, 0},
+    {0x1e43, 0x1e43, 1}, {0x1e44, 0x1e44, 0}, {0x1e45, 0x1e45, 1},
+    {0x1e46, 0x1e46, 0}, {0x1e47, 0x1e47, 1}, {0x1e48, 0x1e48, 0},
+    {0x1e49, 0x1e49, 1}, {0x1e4a, 0x1e4a, 0}, {0x1e4b, 0x1e4b, 1},
+    {0x1e4c, 0x1e4c, 0}, {0x1e4d, 0x1e4d, 1}, {0x1e4e, 0x1e4e, 0},
+    {0x1e4f, 0x1e4f, 1}, {0x1e50, 0x1e50, 0}, {0x1e51, 0x1e51, 1},
+    {0x1e52, 0x1e52, 0}, {0x1e53, 0x1e53, 1}, {0x1e54, 0x1e54, 0},
+    {0x1e55, 0x1e55, 1}, {0x1e56, 0x1e56, 0}, {0x1e57, 0x1e57, 1},
+    {0x1e58, 0x1e58, 0}, {0x1e59, 0x1e59, 1}, {0x1e5a, 0x1e5a, 0},
+    {0x1e5b, 0x1e5b, 1}, {0x1e5c, 0x1e5c, 0}, {0x1e5d, 0x1e5d, 1},
+    {0x1e5e, 0x1e5e, 0}, {0x1e5f, 0x1e5f, 1}, {0x1e60, 0x1e60, 0},
+    {0x1e61, 0x1e61, 1}, {0x1e62, 0x1e62, 0}, {0x1e63, 0x1e63, 1},
+    {0x1e64, 0x1e64, 0}, {0x1e65, 0x1e65, 1}, {0x1e66, 0x1e66, 0},
+    {0x1e67, 0x1e67, 1}, {0x1e68, 0x1e68, 0}, {0x1e69, 0x1e69, 1},
+    {0x1e6a, 0x1e6a, 0}, {0x1e6b, 0x1e6b, 1}, {0x1e6c, 0x1e6c, 0},
+    {0x1e6d, 0x1e6d, 1}, {0x1e6e, 0x1e6e, 0}, {0x1e6f, 0x1e6f, 1},
+    {0x1e70, 0x1e70, 0}, {0x1e71, 0x1e71, 1}, {0x1e72, 0x1e72, 0},
+    {0x1e73, 0x1e73, 1}, {0x1e74, 0x1e74, 0}, {0x1e75, 0x1e75, 1},
+    {0x1e76, 0x1e76, 0}, {0x1e77, 0x1e77, 1}, {0x1e78, 0x1e78, 0},
+    {0x1e79, 0x1e79, 1}, {0x1e7a, 0x1e7a, 0}, {0x1e7b, 0x1e7b, 1},
+    {0x1e7c, 0x1e7c, 0}, {0x1e7d, 0x1e7d, 1}, {0x1e7e, 0x1e7e, 0},
+    {0x1e7f, 0x1e7f, 1}, {0x1e80, 0x1e80, 0}, {0x1e81, 0x1e81, 1},
+    {0x1e82, 0x1e82, 0}, {0x1e83, 0x1e83, 1}, {0x1e84, 0x1e84, 0},
+    {0x1e85, 0x1e85, 1}, {0x1e86, 0x1e86, 0}, {0x1e87, 0x1e87, 1},
+    {0x1e88, 0x1e88, 0}, {0x1e89, 0x1e89, 1}, {0x1e8a, 0x1e8a, 0},
+    {0x1e8b, 0x1e8b, 1}, {0x1e8c, 0x1e8c, 0}, {0x1e8d, 0x1e8d, 1},
+    {0x1e8e, 0x1e8e, 0}, {0x1e8f, 0x1e8f, 1}, {0x1e90, 0x1e90, 0},
+    {0x1e91, 0x1e91, 1}, {0x1e92, 0x1e92, 0}, {0x1e93, 0x1e93, 1},
+    {0x1e94, 0x1e94, 0}, {0x1e95, 0x1e9d, 1}, {0x1e9e, 0x1e9e, 0},
+    {0x1e9f, 0x1e9f, 1}, {0x1ea0, 0x1ea0, 0}, {0x1ea1, 0x1ea1, 1},
+    {0x1ea2, 0x1ea2, 0}, {0x1ea3, 0x1ea3, 1}, {0x1ea4, 0x1ea4, 0},
+    {0x1ea5, 0x1ea5, 1}, {0x1ea6, 0x1ea6, 0}, {0x1ea7, 0x1ea7, 1},
+    {0x1ea8, 0x1ea8, 0}, {0x1ea9, 0x1ea9, 1}, {0x1eaa, 0x1eaa, 0},
+    {0x1eab, 0x1eab, 1}, {0x1eac, 0x1eac, 0}, {0x1ead, 0x1ead, 1},
+    {0x1eae, 0x1eae, 0}, {0x1eaf, 0x1eaf, 1}, {0x1eb0, 0x1eb0, 0},
+    {0x1eb1, 0x1eb1, 1}, {0x1eb2, 0x1eb2, 0}, {0x1eb3, 0x1eb3, 1},
+    {0x1eb4, 0x1eb4, 0}, {0x1eb5, 0x1eb5, 1}, {0x1eb6, 0x1eb6, 0},
+    {0x1eb7, 0x1eb7, 1}, {0x1eb8, 0x1eb8, 0}, {0x1eb9, 0x1eb9, 1},
+    {0x1eba, 0x1eba, 0}, {0x1ebb, 0x1ebb, 1}, {0x1ebc, 0x1ebc, 0},
+    {0x1ebd, 0x1ebd, 1}, {0x1ebe, 0x1ebe, 0}, {0x1ebf, 0x1ebf, 1},
+    {0x1ec0, 0x1ec0, 0}, {0x1ec1, 0x1ec1, 1}, {0x1ec2, 0x1ec2, 0},
+    {0x1ec3, 0x1ec3, 1}, {0x1ec4, 0x1ec4, 0}, {0x1ec5, 0x1ec5, 1},
+    {0x1ec6, 0x1ec6, 0}, {0x1ec7, 0x1ec7, 1}, {0x1ec8, 0x1ec8, 0},
+    {0x1ec9, 0x1ec9, 1}, {0x1eca, 0x1eca, 0}, {0x1ecb, 0x1ecb, 1},
+    {0x1ecc, 0x1ecc, 0}, {0x1ecd, 0x1ecd, 1}, {0x1ece, 0x1ece, 0},
+    {0x1ecf, 0x1ecf, 1}, {0x1ed0, 0x1ed0, 0}, {0x1ed1, 0x1ed1, 1},
+    {0x1ed2, 0x1ed2, 0}, {0x1ed3, 0x1ed3, 1}, {0x1ed4, 0x1ed4, 0},
+    {0x1ed5, 0x1ed5, 1}, {0x1ed6, 0x1ed6, 0}, {0x1ed7, 0x1ed7, 1},
+    {0x1ed8, 0x1ed8, 0}, {0x1ed9, 0x1ed9, 1}, {0x1eda, 0x1eda, 0},
+    {0x1edb, 0x1edb, 1}, {0x1edc, 0x1edc, 0}, {0x1edd, 0x1edd, 1},
+    {0x1ede, 0x1ede, 0}, {0x1edf, 0x1edf, 1}, {0x1ee0, 0x1ee0, 0},
+    {0x1ee1, 0x1ee1, 1}, {0x1ee2, 0x1ee2, 0}, {0x1ee3, 0x1ee3, 1},
+    {0x1ee4, 0x1ee4, 0}, {0x1ee5, 0x1ee5, 1}, {0x1ee6, 0x1ee6, 0},
+    {0x1ee7, 0x1ee7, 1}, {0x1ee8, 0x1ee8, 0}, {0x1ee9, 0x1ee9, 1},
+    {0x1eea, 0x1eea, 0}, {0x1eeb, 0x1eeb, 1}, {0x1eec, 0x1eec, 0},
+    {0x1eed, 0x1eed, 1}, {0x1eee, 0x1eee, 0}, {0x1eef, 0x1eef, 1},
+    {0x1ef0, 0x1ef0, 0}, {0x1ef1, 0x1ef1, 1}, {0x1ef2, 0x1ef2, 0},
+    {0x1ef3, 0x1ef3, 1}, {0x1ef4, 0x1ef4, 0}, {0x1ef5, 0x1ef5, 1},
+    {0x1ef6, 0x1ef6, 0}, {0x1ef7, 0x1ef7, 1}, {0x1ef8, 0x1ef8, 0},
+    {0x1ef9, 0x1ef9, 1}, {0x1efa, 0x1efa, 0}, {0x1efb, 0x1efb, 1},
+    {0x1efc, 0x1efc, 0}, {0x1efd, 0x1efd, 1}, {0x1efe, 0x1efe, 0},
+    {0x1eff, 0x1f07, 1}, {0x1f08, 0x1f0f, 0}, {0x1f10, 0x1f15, 1},
+    {0x1f18, 0x1f1d, 0}, {0x1f20, 0x1f27, 1}, {0x1f28, 0x1f2f, 0},
+    {0x1f30, 0x1f37, 1}, {0x1f38, 0x1f3f, 0}, {0x1f40, 0x1f45, 1},
+    {0x1f48, 0x1f4d, 0}, {0x1f50, 0x1f57, 1}, {0x1f59, 0x1f59, 0},
+    {0x1f5b, 0x1f5b, 0}, {0x1f5d, 0x1f5d, 0}, {0x1f5f, 0x1f5f, 0},
+    {0x1f60, 0x1f67, 1}, {0x1f68, 0x1f6f, 0}, {0x1f70, 0x1f7d, 1},
+    {0x1f80, 0x1f87, 1}, {0x1f88, 0x1f8f, 2}, {0x1f90, 0x1f97, 1},
+    {0x1f98, 0x1f9f, 2}, {0x1fa0, 0x1fa7, 1}, {0x1fa8, 0x1faf, 2},
+    {0x1fb0, 0x1fb4, 1}, {0x1fb6, 0x1fb7, 1}, {0x1fb8, 0x1fbb, 0},
+    {0x1fbc, 0x1fbc, 2}, {0x1fbd, 0x1fbd, 20}, {0x1fbe, 0x1fbe, 1},
+    {0x1fbf, 0x1fc1, 20}, {0x1fc2, 0x1fc4, 1}, {0x1fc6, 0x1fc7, 1},
+    {0x1fc8, 0x1fcb, 0}, {0x1fcc, 0x1fcc, 2}, {0x1fcd, 0x1fcf, 20},
+    {0x1fd0, 0x1fd3, 1}, {0x1fd6, 0x1fd7, 1}, {0x1fd8, 0x1fdb, 0},
+    {0x1fdd, 0x1fdf, 20}, {0x1fe0, 0x1fe7, 1}, {0x1fe8, 0x1fec, 0},
+    {0x1fed, 0x1fef, 20}, {0x1ff2, 0x1ff4, 1}, {0x1ff6, 0x1ff7, 1},
+    {0x1ff8, 0x1ffb, 0}, {0x1ffc, 0x1ffc, 2}, {0x1ffd, 0x1ffe, 20},
+    {0x2000, 0x200a, 22}, {0x200b, 0x200f, 26}, {0x2010, 0x2015, 12},
+    {0x2016, 0x2017, 17}, {0x2018, 0x2018, 15}, {0x2019, 0x2019, 16},
+    {0x201a, 0x201a, 13}, {0x201b, 0x201c, 15}, {0x201d, 0x201d, 16},
+    {0x201e, 0x201e, 13}, {0x201f, 0x201f, 15}, {0x2020, 0x2027, 17},
+    {0x2028, 0x2028, 23}, {0x2029, 0x2029, 24}, {0x202a, 0x202e, 26},
+    {0x202f, 0x202f, 22}, {0x2030, 0x2038, 17}, {0x2039, 0x2039, 15},
+    {0x203a, 0x203a, 16}, {0x203b, 0x203e, 17}, {0x203f, 0x2040, 11},
+    {0x2041, 0x2043, 17}, {0x2044, 0x2044, 18}, {0x2045, 0x2045, 13},
+    {0x2046, 0x2046, 14}, {0x2047, 0x2051, 17}, {0x2052, 0x2052, 18},
+    {0x2053, 0x2053, 17}, {0x2054, 0x2054, 11}, {0x2055, 0x205e, 17},
+    {0x205f, 0x205f, 22}, {0x2060, 0x2064, 26}, {0x2066, 0x206f, 26},
+    {0x2070, 0x2070, 10}, {0x2071, 0x2071, 3}, {0x2074, 0x2079, 10},
+    {0x207a, 0x207c, 18}, {0x207d, 0x207d, 13}, {0x207e, 0x207e, 14},
+    {0x207f, 0x207f, 3}, {0x2080, 0x2089, 10}, {0x208a, 0x208c, 18},
+    {0x208d, 0x208d, 13}, {0x208e, 0x208e, 14}, {0x2090, 0x209c, 3},
+    {0x20a0, 0x20c0, 19}, {0x20d0, 0x20dc, 5}, {0x20dd, 0x20e0, 7},
+    {0x20e1, 0x20e1, 5}, {0x20e2, 0x20e4, 7}, {0x20e5, 0x20f0, 5},
+    {0x2100, 0x2101, 21}, {0x2102, 0x2102, 0}, {0x2103, 0x2106, 21},
+    {0x2107, 0x2107, 0}, {0x2108, 0x2109, 21}, {0x210a, 0x210a, 1},
+    {0x210b, 0x210d, 0}, {0x210e, 0x210f, 1}, {0x2110, 0x2112, 0},
+    {0x2113, 0x2113, 1}, {0x2114, 0x2114, 21}, {0x2115, 0x2115, 0},
+    {0x2116, 0x2117, 21}, {0x2118, 0x2118, 18}, {0x2119, 0x211d, 0},
+    {0x211e, 0x2123, 21}, {0x2124, 0x2124, 0}, {0x2125, 0x2125, 21},
+    {0x2126, 0x2126, 0}, {0x2127, 0x2127, 21}, {0x2128, 0x2128, 0},
+    {0x2129, 0x2129, 21}, {0x212a, 0x212d, 0}, {0x212e, 0x212e, 21},
+    {0x212f, 0x212f, 1}, {0x2130, 0x2133, 0}, {0x2134, 0x2134, 1},
+    {0x2135, 0x2138, 4}, {0x2139, 0x2139, 1}, {0x213a, 0x213b, 21},
+    {0x213c, 0x213d, 1}, {0x213e, 0x213f, 0}, {0x2140, 0x2144, 18},
+    {0x2145, 0x2145, 0}, {0x2146, 0x2149, 1}, {0x214a, 0x214a, 21},
+    {0x214b, 0x214b, 18}, {0x214c, 0x214d, 21}, {0x214e, 0x214e, 1},
+    {0x214f, 0x214f, 21}, {0x2150, 0x215f, 10}, {0x2160, 0x2182, 9},
+    {0x2183, 0x2183, 0}, {0x2184, 0x2184, 1}, {0x2185, 0x2188, 9},
+    {0x2189, 0x2189, 10}, {0x218a, 0x218b, 21}, {0x2190, 0x2194, 18},
+    {0x2195, 0x2199, 21}, {0x219a, 0x219b, 18}, {0x219c, 0x219f, 21},
+    {0x21a0, 0x21a0, 18}, {0x21a1, 0x21a2, 21}, {0x21a3, 0x21a3, 18},
+    {0x21a4, 0x21a5, 21}, {0x21a6, 0x21a6, 18}, {0x21a7, 0x21ad, 21},
+    {0x21ae, 0x21ae, 18}, {0x21af, 0x21cd, 21}, {0x21ce, 0x21cf, 18},
+    {0x21d0, 0x21d1, 21}, {0x21d2, 0x21d2, 18}, {0x21d3, 0x21d3, 21},
+    {0x21d4, 0x21d4, 18}, {0x21d5, 0x21f3, 21}, {0x21f4, 0x22ff, 18},
+    {0x2300, 0x2307, 21}, {0x2308, 0x2308, 13}, {0x2309, 0x2309, 14},
+    {0x230a, 0x230a, 13}, {0x230b, 0x230b, 14}, {0x230c, 0x231f, 21},
+    {0x2320, 0x2321, 18}, {0x2322, 0x2328, 21}, {0x2329, 0x2329, 13},
+    {0x232a, 0x232a, 14}, {0x232b, 0x237b, 21}, {0x237c, 0x237c, 18},
+    {0x237d, 0x239a, 21}, {0x239b, 0x23b3, 18}, {0x23b4, 0x23db, 21},
+    {0x23dc, 0x23e1, 18}, {0x23e2, 0x2426, 21}, {0x2440, 0x244a, 21},
+    {0x2460, 0x249b, 10}, {0x249c, 0x24e9, 21}, {0x24ea, 0x24ff, 10},
+    {0x2500, 0x25b6, 21}, {0x25b7, 0x25b7, 18}, {0x25b8, 0x25c0, 21},
+    {0x25c1, 0x25c1, 18}, {0x25c2, 0x25f7, 21}, {0x25f8, 0x25ff, 18},
+    {0x2600, 0x266e, 21}, {0x266f, 0x266f, 18}, {0x2670, 0x2767, 21},
+    {0x2768, 0x2768, 13}, {0x2769, 0x2769, 14}, {0x276a, 0x276a, 13},
+    {0x276b, 0x276b, 14}, {0x276c, 0x276c, 13}, {0x276d, 0x276d, 14},
+    {0x276e, 0x276e, 13}, {0x276f, 0x276f, 14}, {0x2770, 0x2770, 13},
+    {0x2771, 0x2771, 14}, {0x2772, 0x2772, 13}, {0x2773, 0x2773, 14},
+    {0x2774, 0x2774, 13}, {0x2775, 0x2775, 14}, {0x2776, 0x2793, 10},
+    {0x2794, 0x27bf, 21}, {0x27c0, 0x27c4, 18}, {0x27c5, 0x27c5, 13},
+    {0x27c6, 0x27c6, 14}, {0x27c7, 0x27e5, 18}, {0x27e6, 0x27e6, 13},
+    {0x27e7, 0x27e7, 14}, {0x27e8, 0x27e8, 13}, {0x27e9, 0x27e9, 14},
+    {0x27ea, 0x27ea, 13}, {0x27eb, 0x27eb, 14}, {0x27ec, 0x27ec, 13},
+    {0x27ed, 0x27ed, 14}, {0x27ee, 0x27ee, 13}, {0x27ef, 0x27ef, 14},
+    {0x27f0, 0x27ff, 18}, {0x2800, 0x28ff, 21}, {0x2900, 0x2982, 18},
+    {0x2983, 0x2983, 13}, {0x2984, 0x2984, 14}, {0x2985, 0x2985, 13},
+    {0x2986, 0x2986, 14}, {0x2987, 0x2987, 13}, {0x2988, 0x2988, 14},
+    {0x2989, 0x2989, 13}, {0x298a, 0x298a, 14}, {0x298b, 0x298b, 13},
+    {0x298c, 0x298c, 14}, {0x298d, 0x298d, 13}, {0x298e, 0x298e, 14},
+    {0x298f, 0x298f, 13}, {0x2990, 0x2990, 14}, {0x2991, 0x2991, 13},
+    {0x2992, 0x2992, 14}, {0x2993, 0x2993, 13}, {0x2994, 0x2994, 14},
+    {0x2995, 0x2995, 13}, {0x2996, 0x2996, 14}, {0x2997, 0x2997, 13},
+    {0x2998, 0x2998, 14}, {0x2999, 0x29d7, 18}, {0x29d8, 0x29d8, 13},
+    {0x29d9, 0x29d9, 14}, {0x29da, 0x29da, 13}, {0x29db, 0x29db, 14},
+    {0x29dc, 0x29fb, 18}, {0x29fc, 0x29fc, 13}, {0x29fd, 0x29fd, 14},
+    {0x29fe, 0x2aff, 18}, {0x2b00, 0x2b2f, 21}, {0x2b30, 0x2b44, 18},
+    {0x2b45, 0x2b46, 21}, {0x2b47, 0x2b4c, 18}, {0x2b4d, 0x2b73, 21},
+    {0x2b76, 0x2b95, 21}, {0x2b97, 0x2bff, 21}, {0x2c00, 0x2c2f, 0},
+    {0x2c30, 0x2c5f, 1}, {0x2c60, 0x2c60, 0}, {0x2c61, 0x2c61, 1},
+    {0x2c62, 0x2c64, 0}, {0x2c65, 0x2c66, 1}, {0x2c67, 0x2c67, 0},
+    {0x2c68, 0x2c68, 1}, {0x2c69, 0x2c69, 0}, {0x2c6a, 0x2c6a, 1},
+    {0x2c6b, 0x2c6b, 0}, {0x2c6c, 0x2c6c, 1}, {0x2c6d, 0x2c70, 0},
+    {0x2c71, 0x2c71, 1}, {0x2c72, 0x2c72, 0}, {0x2c73, 0x2c74, 1},
+    {0x2c75, 0x2c75, 0}, {0x2c76, 0x2c7b, 1}, {0x2c7c, 0x2c7d, 3},
+    {0x2c7e, 0x2c80, 0}, {0x2c81, 0x2c81, 1}, {0x2c82, 0x2c82, 0},
+    {0x2c83, 0x2c83, 1}, {0x2c84, 0x2c84, 0}, {0x2c85, 0x2c85, 1},
+    {0x2c86, 0x2c86, 0}, {0x2c87, 0x2c87, 1}, {0x2c88, 0x2c88, 0},
+    {0x2c89, 0x2c89, 1}, {0x2c8a, 0x2c8a, 0}, {0x2c8b, 0x2c8b, 1},
+    {0x2c8c, 0x2c8c, 0}, {0x2c8d, 0x2c8d, 1}, {0x2c8e, 0x2c8e, 0},
+    {0x2c8f, 0x2c8f, 1}, {0x2c90, 0x2c90, 0}, {0x2c91, 0x2c91, 1},
+    {0x2c92, 0x2c92, 0}, {0x2c93, 0x2c93, 1}, {0x2c94, 0x2c94, 0},
+    {0x2c95, 0x2c95, 1}, {0x2c96, 0x2c96, 0}, {0x2c97, 0x2c97, 1},
+    {0x2c98, 0x2c98, 0}, {0x2c99, 0x2c99, 1}, {0x2c9a, 0x2c9a, 0},
+    {0x2c9b, 0x2c9b, 1}, {0x2c9c, 0x2c9c, 0}, {0x2c9d, 0x2c9d, 1},
+    {0x2c9e, 0x2c9e, 0}, {0x2c9f, 0x2c9f, 1}, {0x2ca0, 0x2ca0, 0},
+    {0x2ca1, 0x2ca1, 1}, {0x2ca2, 0x2ca2, 0}, {0x2ca3, 0x2ca3, 1},
+    {0x2ca4, 0x2ca4, 0}, {0x2ca5, 0x2ca5, 1}, {0x2ca6, 0x2ca6, 0},
+    {0x2ca7, 0x2ca7, 1}, {0x2ca8, 0x2ca8, 0}, {0x2ca9, 0x2ca9, 1},
+    {0x2caa, 0x2caa, 0}, {0x2cab, 0x2cab, 1}, {0x2cac, 0x2cac, 0},
+    {0x2cad, 0x2cad, 1}, {0x2cae, 0x2cae, 0}, {0x2caf, 0x2caf, 1},
+    {0x2cb0, 0x2cb0, 0}, {0x2cb1, 0x2cb1, 1}, {0x2cb2, 0x2cb2, 0},
+    {0x2cb3, 0x2cb3, 1}, {0x2cb4, 0x2cb4, 0}, {0x2cb5, 0x2cb5, 1},
+    {0x2cb6, 0x2cb6, 0}, {0x2cb7, 0x2cb7, 1}, {0x2cb8, 0x2cb8, 0},
+    {0x2cb9, 0x2cb9, 1}, {0x2cba, 0x2cba, 0}, {0x2cbb, 0x2cbb, 1},
+    {0x2cbc, 0x2cbc, 0}, {0x2cbd, 0x2cbd, 1}, {0x2cbe, 0x2cbe, 0},
+    {0x2cbf, 0x2cbf, 1}, {0x2cc0, 0x2cc0, 0}, {0x2cc1, 0x2cc1, 1},
+    {0x2cc2, 0x2cc2, 0}, {0x2cc3, 0x2cc3, 1}, {0x2cc4, 0x2cc4, 0},
+    {0x2cc5, 0x2cc5, 1}, {0x2cc6, 0x2cc6, 0}, {0x2cc7, 0x2cc7, 1},
+    {0x2cc8, 0x2cc8, 0}, {0x2cc9, 0x2cc9, 1}, {0x2cca, 0x2cca, 0},
+    {0x2ccb, 0x2ccb, 1}, {0x2ccc, 0x2ccc, 0}, {0x2ccd, 0x2ccd, 1},
+    {0x2cce, 0x2cce, 0}, {0x2ccf, 0x2ccf, 1}, {0x2cd0, 0x2cd0, 0},
+    {0x2cd1, 0x2cd1, 1}, {0x2cd2, 0x2cd2, 0}, {0x2cd3, 0x2cd3, 1},
+    {0x2cd4, 0x2cd4, 0}, {0x2cd5, 0x2cd5, 1}, {0x2cd6, 0x2cd6, 0},
+    {0x2cd7, 0x2cd7, 1}, {0x2cd8, 0x2cd8, 0}, {0x2cd9, 0x2cd9, 1},
+    {0x2cda, 0x2cda, 0}, {0x2cdb, 0x2cdb, 1}, {0x2cdc, 0x2cdc, 0},
+    {0x2cdd, 0x2cdd, 1}, {0x2cde, 0x2cde, 0}, {0x2cdf, 0x2cdf, 1},
+    {0x2ce0, 0x2ce0, 0}, {0x2ce1, 0x2ce1, 1}, {0x2ce2, 0x2ce2, 0},
+    {0x2ce3, 0x2ce4, 1}, {0x2ce5, 0x2cea, 21}, {0x2ceb, 0x2ceb, 0},
+    {0x2cec, 0x2cec, 1}, {0x2ced, 0x2ced, 0}, {0x2cee, 0x2cee, 1},
+    {0x2cef, 0x2cf1, 5}, {0x2cf2, 0x2cf2, 0}, {0x2cf3, 0x2cf3, 1},
+    {0x2cf9, 0x2cfc, 17}, {0x2cfd, 0x2cfd, 10}, {0x2cfe, 0x2cff, 17},
+    {0x2d00, 0x2d25, 1}, {0x2d27, 0x2d27, 1}, {0x2d2d, 0x2d2d, 1},
+    {0x2d30, 0x2d67, 4}, {0x2d6f, 0x2d6f, 3}, {0x2d70, 0x2d70, 17},
+    {0x2d7f, 0x2d7f, 5}, {0x2d80, 0x2d96, 4}, {0x2da0, 0x2da6, 4},
+    {0x2da8, 0x2dae, 4}, {0x2db0, 0x2db6, 4}, {0x2db8, 0x2dbe, 4},
+    {0x2dc0, 0x2dc6, 4}, {0x2dc8, 0x2dce, 4}, {0x2dd0, 0x2dd6, 4},
+    {0x2dd8, 0x2dde, 4}, {0x2de0, 0x2dff, 5}, {0x2e00, 0x2e01, 17},
+    {0x2e02, 0x2e02, 15}, {0x2e03, 0x2e03, 16}, {0x2e04, 0x2e04, 15},
+    {0x2e05, 0x2e05, 16}, {0x2e06, 0x2e08, 17}, {0x2e09, 0x2e09, 15},
+    {0x2e0a, 0x2e0a, 16}, {0x2e0b, 0x2e0b, 17}, {0x2e0c, 0x2e0c, 15},
+    {0x2e0d, 0x2e0d, 16}, {0x2e0e, 0x2e16, 17}, {0x2e17, 0x2e17, 12},
+    {0x2e18, 0x2e19, 17}, {0x2e1a, 0x2e1a, 12}, {0x2e1b, 0x2e1b, 17},
+    {0x2e1c, 0x2e1c, 15}, {0x2e1d, 0x2e1d, 16}, {0x2e1e, 0x2e1f, 17},
+    {0x2e20, 0x2e20, 15}, {0x2e21, 0x2e21, 16}, {0x2e22, 0x2e22, 13},
+    {0x2e23, 0x2e23, 14}, {0x2e24, 0x2e24, 13}, {0x2e25, 0x2e25, 14},
+    {0x2e26, 0x2e26, 13}, {0x2e27, 0x2e27, 14}, {0x2e28, 0x2e28, 13},
+    {0x2e29, 0x2e29, 14}, {0x2e2a, 0x2e2e, 17}, {0x2e2f, 0x2e2f, 3},
+    {0x2e30, 0x2e39, 17}, {0x2e3a, 0x2e3b, 12}, {0x2e3c, 0x2e3f, 17},
+    {0x2e40, 0x2e40, 12}, {0x2e41, 0x2e41, 17}, {0x2e42, 0x2e42, 13},
+    {0x2e43, 0x2e4f, 17}, {0x2e50, 0x2e51, 21}, {0x2e52, 0x2e54, 17},
+    {0x2e55, 0x2e55, 13}, {0x2e56, 0x2e56, 14}, {0x2e57, 0x2e57, 13},
+    {0x2e58, 0x2e58, 14}, {0x2e59, 0x2e59, 13}, {0x2e5a, 0x2e5a, 14},
+    {0x2e5b, 0x2e5b, 13}, {0x2e5c, 0x2e5c, 14}, {0x2e5d, 0x2e5d, 12},
+    {0x2e80, 0x2e99, 21}, {0x2e9b, 0x2ef3, 21}, {0x2f00, 0x2fd5, 21},
+    {0x2ff0, 0x2ffb, 21}, {0x3000, 0x3000, 22}, {0x3001, 0x3003, 17},
+    {0x3004, 0x3004, 21}, {0x3005, 0x3005, 3}, {0x3006, 0x3006, 4},
+    {0x3007, 0x3007, 9}, {0x3008, 0x3008, 13}, {0x3009, 0x3009, 14},
+    {0x300a, 0x300a, 13}, {0x300b, 0x300b, 14}, {0x300c, 0x300c, 13},
+    {0x300d, 0x300d, 14}, {0x300e, 0x300e, 13}, {0x300f, 0x300f, 14},
+    {0x3010, 0x3010, 13}, {0x3011, 0x3011, 14}, {0x3012, 0x3013, 21},
+    {0x3014, 0x3014, 13}, {0x3015, 0x3015, 14}, {0x3016, 0x3016, 13},
+    {0x3017, 0x3017, 14}, {0x3018, 0x3018, 13}, {0x3019, 0x3019, 14},
+    {0x301a, 0x301a, 13}, {0x301b, 0x301b, 14}, {0x301c, 0x301c, 12},
+    {0x301d, 0x301d, 13}, {0x301e, 0x301f, 14}, {0x3020, 0x3020, 21},
+    {0x3021, 0x3029, 9}, {0x302a, 0x302d, 5}, {0x302e, 0x302f, 6},
+    {0x3030, 0x3030, 12}, {0x3031, 0x3035, 3}, {0x3036, 0x3037, 21},
+    {0x3038, 0x303a, 9}, {0x303b, 0x303b, 3}, {0x303c, 0x303c, 4},
+    {0x303d, 0x303d, 17}, {0x303e, 0x303f, 21}, {0x3041, 0x3096, 4},
+    {0x3099, 0x309a, 5}, {0x309b, 0x309c, 20}, {0x309d, 0x309e, 3},
+    {0x309f, 0x309f, 4}, {0x30a0, 0x30a0, 12}, {0x30a1, 0x30fa, 4},
+    {0x30fb, 0x30fb, 17}, {0x30fc, 0x30fe, 3}, {0x30ff, 0x30ff, 4},
+    {0x3105, 0x312f, 4}, {0x3131, 0x318e, 4}, {0x3190, 0x3191, 21},
+    {0x3192, 0x3195, 10}, {0x3196, 0x319f, 21}, {0x31a0, 0x31bf, 4},
+    {0x31c0, 0x31e3, 21}, {0x31f0, 0x31ff, 4}, {0x3200, 0x321e, 21},
+    {0x3220, 0x3229, 10}, {0x322a, 0x3247, 21}, {0x3248, 0x324f, 10},
+    {0x3250, 0x3250, 21}, {0x3251, 0x325f, 10}, {0x3260, 0x327f, 21},
+    {0x3280, 0x3289, 10}, {0x328a, 0x32b0, 21}, {0x32b1, 0x32bf, 10},
+    {0x32c0, 0x33ff, 21}, {0x3400, 0x4dbf, 4}, {0x4dc0, 0x4dff, 21},
+    {0x4e00, 0xa014, 4}, {0xa015, 0xa015, 3}, {0xa016, 0xa48c, 4},
+    {0xa490, 0xa4c6, 21}, {0xa4d0, 0xa4f7, 4}, {0xa4f8, 0xa4fd, 3},
+    {0xa4fe, 0xa4ff, 17}, {0xa500, 0xa60b, 4}, {0xa60c, 0xa60c, 3},
+    {0xa60d, 0xa60f, 17}, {0xa610, 0xa61f, 4}, {0xa620, 0xa629, 8},
+    {0xa62a, 0xa62b, 4}, {0xa640, 0xa640, 0}, {0xa641, 0xa641, 1},
+    {0xa642, 0xa642, 0}, {0xa643, 0xa643, 1}, {0xa644, 0xa644, 0},
+    {0xa645, 0xa645, 1}, {0xa646, 0xa646, 0}, {0xa647, 0xa647, 1},
+    {0xa648, 0xa648, 0}, {0xa649, 0xa649, 1}, {0xa64a, 0xa64a, 0},
+    {0xa64b, 0xa64b, 1}, {0xa64c, 0xa64c, 0}, {0xa64d, 0xa64d, 1},
+    {0xa64e, 0xa64e, 0}, {0xa64f, 0xa64f, 1}, {0xa650, 0xa650, 0},
+    {0xa651, 0xa651, 1}, {0xa652, 0xa652, 0}, {0xa653, 0xa653, 1},
+    {0xa654, 0xa654, 0}, {0xa655, 0xa655, 1}, {0xa656, 0xa656, 0},
+    {0xa657, 0xa657, 1}, {0xa658, 0xa658, 0}, {0xa659, 0xa659, 1},
+    {0xa65a, 0xa65a, 0}, {0xa65b, 0xa65b, 1}, {0xa65c, 0xa65c, 0},
+    {0xa65d, 0xa65d, 1}, {0xa65e, 0xa65e, 0}, {0xa65f, 0xa65f, 1},
+    {0xa660, 0xa660, 0}, {0xa661, 0xa661, 1}, {0xa662, 0xa662, 0},
+    {0xa663, 0xa663, 1}, {0xa664, 0xa664, 0}, {0xa665, 0xa665, 1},
+    {0xa666, 0xa666, 0}, {0xa667, 0xa667, 1}, {0xa668, 0xa668, 0},
+    {0xa669, 0xa669, 1}, {0xa66a, 0xa66a, 0}, {0xa66b, 0xa66b, 1},
+    {0xa66c, 0xa66c, 0}, {0xa66d, 0xa66d, 1}, {0xa66e, 0xa66e, 4},
+    {0xa66f, 0xa66f, 5}, {0xa670, 0xa672, 7}, {0xa673, 0xa673, 17},
+    {0xa674, 0xa67d, 5}, {0xa67e, 0xa67e, 17}, {0xa67f, 0xa67f, 3},
+    {0xa680, 0xa680, 0}, {0xa681, 0xa681, 1}, {0xa682, 0xa682, 0},
+    {0xa683, 0xa683, 1}, {0xa684, 0xa684, 0}, {0xa685, 0xa685, 1},
+    {0xa686, 0xa686, 0}, {0xa687, 0xa687, 1}, {0xa688, 0xa688, 0},
+    {0xa689, 0xa689, 1}, {0xa68a, 0xa68a, 0}, {0xa68b, 0xa68b, 1},
+    {0xa68c, 0xa68c, 0}, {0xa68d, 0xa68d, 1}, {0xa68e, 0xa68e, 0},
+    {0xa68f, 0xa68f, 1}, {0xa690, 0xa690, 0}, {0xa691, 0xa691, 1},
+    {0xa692, 0xa692, 0}, {0xa693, 0xa693, 1}, {0xa694, 0xa694, 0},
+    {0xa695, 0xa695, 1}, {0xa696, 0xa696, 0}, {0xa697, 0xa697, 1},
+    {0xa698, 0xa698, 0}, {0xa699, 0xa699, 1}, {0xa69a, 0xa69a, 0},
+    {0xa69b, 0xa69b, 1}, {0xa69c, 0xa69d, 3}, {0xa69e, 0xa69f, 5},
+    {0xa6a0, 0xa6e5, 4}, {0xa6e6, 0xa6ef, 9}, {0xa6f0, 0xa6f1, 5},
+    {0xa6f2, 0xa6f7, 17}, {0xa700, 0xa716, 20}, {0xa717, 0xa71f, 3},
+    {0xa720, 0xa721, 20}, {0xa722, 0xa722, 0}, {0xa723, 0xa723, 1},
+    {0xa724, 0xa724, 0}, {0xa725, 0xa725, 1}, {0xa726, 0xa726, 0},
+    {0xa727, 0xa727, 1}, {0xa728, 0xa728, 0}, {0xa729, 0xa729, 1},
+    {0xa72a, 0xa72a, 0}, {0xa72b, 0xa72b, 1}, {0xa72c, 0xa72c, 0},
+    {0xa72d, 0xa72d, 1}, {0xa72e, 0xa72e, 0}, {0xa72f, 0xa731, 1},
+    {0xa732, 0xa732, 0}, {0xa733, 0xa733, 1}, {0xa734, 0xa734, 0},
+    {0xa735, 0xa735, 1}, {0xa736, 0xa736, 0}, {0xa737, 0xa737, 1},
+    {0xa738, 0xa738, 0}, {0xa739, 0xa739, 1}, {0xa73a, 0xa73a, 0},
+    {0xa73b, 0xa73b, 1}, {0xa73c, 0xa73c, 0}, {0xa73d, 0xa73d, 1},
+    {0xa73e, 0xa73e, 0}, {0xa73f, 0xa73f, 1}, {0xa740, 0xa740, 0},
+    {0xa741, 0xa741, 1}, {0xa742, 0xa742, 0}, {0xa743, 0xa743, 1},
+    {0xa744, 0xa744, 0}, {0xa745, 0xa745, 1}, {0xa746, 0xa746, 0},
+    {0xa747, 0xa747, 1}, {0xa748, 0xa748, 0}, {0xa749, 0xa749, 1},
+    {0xa74a, 0xa74a, 0}, {0xa74b, 0xa74b, 1}, {0xa74c, 0xa74c, 0},
+    {0xa74d, 0xa74d, 1}, {0xa74e, 0xa74e, 0}, {0xa74f, 0xa74f, 1},
+    {0xa750, 0xa750, 0}, {0xa751, 0xa751, 1}, {0xa752, 0xa752, 0},
+    {0xa753, 0xa753, 1}, {0xa754, 0xa754, 0}, {0xa755, 0xa755, 1},
+    {0xa756, 0xa756, 0}, {0xa757, 0xa757, 1}, {0xa758, 0xa758, 0},
+    {0xa759, 0xa759, 1}, {0xa75a, 0xa75a, 0}, {0xa75b, 0xa75b, 1},
+    {0xa75c, 0xa75c, 0}, {0xa75d, 0xa75d, 1}, {0xa75e, 0xa75e, 0},
+    {0xa75f, 0xa75f, 1}, {0xa760, 0xa760, 0}, {0xa761, 0xa761, 1},
+    {0xa762, 0xa762, 0}, {0xa763, 0xa763, 1}, {0xa764, 0xa764, 0},
+    {0xa765, 0xa765, 1}, {0xa766, 0xa766, 0}, {0xa767, 0xa767, 1},
+    {0xa768, 0xa768, 0}, {0xa769, 0xa769, 1}, {0xa76a, 0xa76a, 0},
+    {0xa76b, 0xa76b, 1}, {0xa76c, 0xa76c, 0}, {0xa76d, 0xa76d, 1},
+    {0xa76e, 0xa76e, 0}, {0xa76f, 0xa76f, 1}, {0xa770, 0xa770, 3},
+    {0xa771, 0xa778, 1}, {0xa779, 0xa779, 0}, {0xa77a, 0xa77a, 1},
+    {0xa77b, 0xa77b, 0}, {0xa77c, 0xa77c, 1}, {0xa77d, 0xa77e, 0},
+    {0xa77f, 0xa77f, 1}, {0xa780, 0xa780, 0}, {0xa781, 0xa781, 1},
+    {0xa782, 0xa782, 0}, {0xa783, 0xa783, 1}, {0xa784, 0xa784, 0},
+    {0xa785, 0xa785, 1}, {0xa786, 0xa786, 0}, {0xa787, 0xa787, 1},
+    {0xa788, 0xa788, 3}, {0xa789, 0xa78a, 20}, {0xa78b, 0xa78b, 0},
+    {0xa78c, 0xa78c, 1}, {0xa78d, 0xa78d, 0}, {0xa78e, 0xa78e, 1},
+    {0xa78f, 0xa78f, 4}, {0xa790, 0xa790, 0}, {0xa791, 0xa791, 1},
+    {0xa792, 0xa792, 0}, {0xa793, 0xa795, 1}, {0xa796, 0xa796, 0},
+    {0xa797, 0xa797, 1}, {0xa798, 0xa798, 0}, {0xa799, 0xa799, 1},
+    {0xa79a, 0xa79a, 0}, {0xa79b, 0xa79b, 1}, {0xa79c, 0xa79c, 0},
+    {0xa79d, 0xa79d, 1}, {0xa79e, 0xa79e, 0}, {0xa79f, 0xa79f, 1},
+    {0xa7a0, 0xa7a0, 0}, {0xa7a1, 0xa7a1, 1}, {0xa7a2, 0xa7a2, 0},
+    {0xa7a3, 0xa7a3, 1}, {0xa7a4, 0xa7a4, 0}, {0xa7a5, 0xa7a5, 1},
+    {0xa7a6, 0xa7a6, 0}, {0xa7a7, 0xa7a7, 1}, {0xa7a8, 0xa7a8, 0},
+    {0xa7a9, 0xa7a9, 1}, {0xa7aa, 0xa7ae, 0}, {0xa7af, 0xa7af, 1},
+    {0xa7b0, 0xa7b4, 0}, {0xa7b5, 0xa7b5, 1}, {0xa7b6, 0xa7b6, 0},
+    {0xa7b7, 0xa7b7, 1}, {0xa7b8, 0xa7b8, 0}, {0xa7b9, 0xa7b9, 1},
+    {0xa7ba, 0xa7ba, 0}, {0xa7bb, 0xa7bb, 1}, {0xa7bc, 0xa7bc, 0},
+    {0xa7bd, 0xa7bd, 1}, {0xa7be, 0xa7be, 0}, {0xa7bf, 0xa7bf, 1},
+    {0xa7c0, 0xa7c0, 0}, {0xa7c1, 0xa7c1, 1}, {0xa7c2, 0xa7c2, 0},
+    {0xa7c3, 0xa7c3, 1}, {0xa7c4, 0xa7c7, 0}, {0xa7c8, 0xa7c8, 1},
+    {0xa7c9, 0xa7c9, 0}, {0xa7ca, 0xa7ca, 1}, {0xa7d0, 0xa7d0, 0},
+    {0xa7d1, 0xa7d1, 1}, {0xa7d3, 0xa7d3, 1}, {0xa7d5, 0xa7d5, 1},
+    {0xa7d6, 0xa7d6, 0}, {0xa7d7, 0xa7d7, 1}, {0xa7d8, 0xa7d8, 0},
+    {0xa7d9, 0xa7d9, 1}, {0xa7f2, 0xa7f4, 3}, {0xa7f5, 0xa7f5, 0},
+    {0xa7f6, 0xa7f6, 1}, {0xa7f7, 0xa7f7, 4}, {0xa7f8, 0xa7f9, 3},
+    {0xa7fa, 0xa7fa, 1}, {0xa7fb, 0xa801, 4}, {0xa802, 0xa802, 5},
+    {0xa803, 0xa805, 4}, {0xa806, 0xa806, 5}, {0xa807, 0xa80a, 4},
+    {0xa80b, 0xa80b, 5}, {0xa80c, 0xa822, 4}, {0xa823, 0xa824, 6},
+    {0xa825, 0xa826, 5}, {0xa827, 0xa827, 6}, {0xa828, 0xa82b, 21},
+    {0xa82c, 0xa82c, 5}, {0xa830, 0xa835, 10}, {0xa836, 0xa837, 21},
+    {0xa838, 0xa838, 19}, {0xa839, 0xa839, 21}, {0xa840, 0xa873, 4},
+    {0xa874, 0xa877, 17}, {0xa880, 0xa881, 6}, {0xa882, 0xa8b3, 4},
+    {0xa8b4, 0xa8c3, 6}, {0xa8c4, 0xa8c5, 5}, {0xa8ce, 0xa8cf, 17},
+    {0xa8d0, 0xa8d9, 8}, {0xa8e0, 0xa8f1, 5}, {0xa8f2, 0xa8f7, 4},
+    {0xa8f8, 0xa8fa, 17}, {0xa8fb, 0xa8fb, 4}, {0xa8fc, 0xa8fc, 17},
+    {0xa8fd, 0xa8fe, 4}, {0xa8ff, 0xa8ff, 5}, {0xa900, 0xa909, 8},
+    {0xa90a, 0xa925, 4}, {0xa926, 0xa92d, 5}, {0xa92e, 0xa92f, 17},
+    {0xa930, 0xa946, 4}, {0xa947, 0xa951, 5}, {0xa952, 0xa953, 6},
+    {0xa95f, 0xa95f, 17}, {0xa960, 0xa97c, 4}, {0xa980, 0xa982, 5},
+    {0xa983, 0xa983, 6}, {0xa984, 0xa9b2, 4}, {0xa9b3, 0xa9b3, 5},
+    {0xa9b4, 0xa9b5, 6}, {0xa9b6, 0xa9b9, 5}, {0xa9ba, 0xa9bb, 6},
+    {0xa9bc, 0xa9bd, 5}, {0xa9be, 0xa9c0, 6}, {0xa9c1, 0xa9cd, 17},
+    {0xa9cf, 0xa9cf, 3}, {0xa9d0, 0xa9d9, 8}, {0xa9de, 0xa9df, 17},
+    {0xa9e0, 0xa9e4, 4}, {0xa9e5, 0xa9e5, 5}, {0xa9e6, 0xa9e6, 3},
+    {0xa9e7, 0xa9ef, 4}, {0xa9f0, 0xa9f9, 8}, {0xa9fa, 0xa9fe, 4},
+    {0xaa00, 0xaa28, 4}, {0xaa29, 0xaa2e, 5}, {0xaa2f, 0xaa30, 6},
+    {0xaa31, 0xaa32, 5}, {0xaa33, 0xaa34, 6}, {0xaa35, 0xaa36, 5},
+    {0xaa40, 0xaa42, 4}, {0xaa43, 0xaa43, 5}, {0xaa44, 0xaa4b, 4},
+    {0xaa4c, 0xaa4c, 5}, {0xaa4d, 0xaa4d, 6}, {0xaa50, 0xaa59, 8},
+    {0xaa5c, 0xaa5f, 17}, {0xaa60, 0xaa6f, 4}, {0xaa70, 0xaa70, 3},
+    {0xaa71, 0xaa76, 4}, {0xaa77, 0xaa79, 21}, {0xaa7a, 0xaa7a, 4},
+    {0xaa7b, 0xaa7b, 6}, {0xaa7c, 0xaa7c, 5}, {0xaa7d, 0xaa7d, 6},
+    {0xaa7e, 0xaaaf, 4}, {0xaab0, 0xaab0, 5}, {0xaab1, 0xaab1, 4},
+    {0xaab2, 0xaab4, 5}, {0xaab5, 0xaab6, 4}, {0xaab7, 0xaab8, 5},
+    {0xaab9, 0xaabd, 4}, {0xaabe, 0xaabf, 5}, {0xaac0, 0xaac0, 4},
+    {0xaac1, 0xaac1, 5}, {0xaac2, 0xaac2, 4}, {0xaadb, 0xaadc, 4},
+    {0xaadd, 0xaadd, 3}, {0xaade, 0xaadf, 17}, {0xaae0, 0xaaea, 4},
+    {0xaaeb, 0xaaeb, 6}, {0xaaec, 0xaaed, 5}, {0xaaee, 0xaaef, 6},
+    {0xaaf0, 0xaaf1, 17}, {0xaaf2, 0xaaf2, 4}, {0xaaf3, 0xaaf4, 3},
+    {0xaaf5, 0xaaf5, 6}, {0xaaf6, 0xaaf6, 5}, {0xab01, 0xab06, 4},
+    {0xab09, 0xab0e, 4}, {0xab11, 0xab16, 4}, {0xab20, 0xab26, 4},
+    {0xab28, 0xab2e, 4}, {0xab30, 0xab5a, 1}, {0xab5b, 0xab5b, 20},
+    {0xab5c, 0xab5f, 3}, {0xab60, 0xab68, 1}, {0xab69, 0xab69, 3},
+    {0xab6a, 0xab6b, 20}, {0xab70, 0xabbf, 1}, {0xabc0, 0xabe2, 4},
+    {0xabe3, 0xabe4, 6}, {0xabe5, 0xabe5, 5}, {0xabe6, 0xabe7, 6},
+    {0xabe8, 0xabe8, 5}, {0xabe9, 0xabea, 6}, {0xabeb, 0xabeb, 17},
+    {0xabec, 0xabec, 6}, {0xabed, 0xabed, 5}, {0xabf0, 0xabf9, 8},
+    {0xac00, 0xd7a3, 4}, {0xd7b0, 0xd7c6, 4}, {0xd7cb, 0xd7fb, 4},
+    {0xd800, 0xdfff, 27}, {0xe000, 0xf8ff, 28}, {0xf900, 0xfa6d, 4},
+    {0xfa70, 0xfad9, 4}, {0xfb00, 0xfb06, 1}, {0xfb13, 0xfb17, 1},
+    {0xfb1d, 0xfb1d, 4}, {0xfb1e, 0xfb1e, 5}, {0xfb1f, 0xfb28, 4},
+    {0xfb29, 0xfb29, 18}, {0xfb2a, 0xfb36, 4}, {0xfb38, 0xfb3c, 4},
+    {0xfb3e, 0xfb3e, 4}, {0xfb40, 0xfb41, 4}, {0xfb43, 0xfb44, 4},
+    {0xfb46, 0xfbb1, 4}, {0xfbb2, 0xfbc2, 20}, {0xfbd3, 0xfd3d, 4},
+    {0xfd3e, 0xfd3e, 14}, {0xfd3f, 0xfd3f, 13}, {0xfd40, 0xfd4f, 21},
+    {0xfd50, 0xfd8f, 4}, {0xfd92, 0xfdc7, 4}, {0xfdcf, 0xfdcf, 21},
+    {0xfdf0, 0xfdfb, 4}, {0xfdfc, 0xfdfc, 19}, {0xfdfd, 0xfdff, 21},
+    {0xfe00, 0xfe0f, 5}, {0xfe10, 0xfe16, 17}, {0xfe17, 0xfe17, 13},
+    {0xfe18, 0xfe18, 14}, {0xfe19, 0xfe19, 17}, {0xfe20, 0xfe2f, 5},
+    {0xfe30, 0xfe30, 17}, {0xfe31, 0xfe32, 12}, {0xfe33, 0xfe34, 11},
+    {0xfe35, 0xfe35, 13}, {0xfe36, 0xfe36, 14}, {0xfe37, 0xfe37, 13},
+    {0xfe38, 0xfe38, 14}, {0xfe39, 0xfe39, 13}, {0xfe3a, 0xfe3a, 14},
+    {0xfe3b, 0xfe3b, 13}, {0xfe3c, 0xfe3c, 14}, {0xfe3d, 0xfe3d, 13},
+    {0xfe3e, 0xfe3e, 14}, {0xfe3f, 0xfe3f, 13}, {0xfe40, 0xfe40, 14},
+    {0xfe41, 0xfe41, 13}, {0xfe42, 0xfe42, 14}, {0xfe43, 0xfe43, 13},
+    {0xfe44, 0xfe44, 14}, {0xfe45, 0xfe46, 17}, {0xfe47, 0xfe47, 13},
+    {0xfe48, 0xfe48, 14}, {0xfe49, 0xfe4c, 17}, {0xfe4d, 0xfe4f, 11},
+    {0xfe50, 0xfe52, 17}, {0xfe54, 0xfe57, 17}, {0xfe58, 0xfe58, 12},
+    {0xfe59, 0xfe59, 13}, {0xfe5a, 0xfe5a, 14}, {0xfe5b, 0xfe5b, 13},
+    {0xfe5c, 0xfe5c, 14}, {0xfe5d, 0xfe5d, 13}, {0xfe5e, 0xfe5e, 14},
+    {0xfe5f, 0xfe61, 17}, {0xfe62, 0xfe62, 18}, {0xfe63, 0xfe63, 12},
+    {0xfe64, 0xfe66, 18}, {0xfe68, 0xfe68, 17}, {0xfe69, 0xfe69, 19},
+    {0xfe6a, 0xfe6b, 17}, {0xfe70, 0xfe74, 4}, {0xfe76, 0xfefc, 4},
+    {0xfeff, 0xfeff, 26}, {0xff01, 0xff03, 17}, {0xff04, 0xff04, 19},
+    {0xff05, 0xff07, 17}, {0xff08, 0xff08, 13}, {0xff09, 0xff09, 14},
+    {0xff0a, 0xff0a, 17}, {0xff0b, 0xff0b, 18}, {0xff0c, 0xff0c, 17},
+    {0xff0d, 0xff0d, 12}, {0xff0e, 0xff0f, 17}, {0xff10, 0xff19, 8},
+    {0xff1a, 0xff1b, 17}, {0xff1c, 0xff1e, 18}, {0xff1f, 0xff20, 17},
+    {0xff21, 0xff3a, 0}, {0xff3b, 0xff3b, 13}, {0xff3c, 0xff3c, 17},
+    {0xff3d, 0xff3d, 14}, {0xff3e, 0xff3e, 20}, {0xff3f, 0xff3f, 11},
+    {0xff40, 0xff40, 20}, {0xff41, 0xff5a, 1}, {0xff5b, 0xff5b, 13},
+    {0xff5c, 0xff5c, 18}, {0xff5d, 0xff5d, 14}, {0xff5e, 0xff5e, 18},
+    {0xff5f, 0xff5f, 13}, {0xff60, 0xff60, 14}, {0xff61, 0xff61, 17},
+    {0xff62, 0xff62, 13}, {0xff63, 0xff63, 14}, {0xff64, 0xff65, 17},
+    {0xff66, 0xff6f, 4}, {0xff70, 0xff70, 3}, {0xff71, 0xff9d, 4},
+    {0xff9e, 0xff9f, 3}, {0xffa0, 0xffbe, 4}, {0xffc2, 0xffc7, 4},
+    {0xffca, 0xffcf, 4}, {0xffd2, 0xffd7, 4}, {0xffda, 0xffdc, 4},
+    {0xffe0, 0xffe1, 19}, {0xffe2, 0xffe2, 18}, {0xffe3, 0xffe3, 20},
+    {0xffe4, 0xffe4, 21}, {0xffe5, 0xffe6, 19}, {0xffe8, 0xffe8, 21},
+    {0xffe9, 0xffec, 18}, {0xffed, 0xffee, 21}, {0xfff9, 0xfffb, 26},
+    {0xfffc, 0xfffd, 21}, {0x10000, 0x1000b, 4}, {0x1000d, 0x10026, 4},
+    {0x10028, 0x1003a, 4}, {0x1003c, 0x1003d, 4}, {0x1003f, 0x1004d, 4},
+    {0x10050, 0x1005d, 4}, {0x10080, 0x100fa, 4}, {0x10100, 0x10102, 17},
+    {0x10107, 0x10133, 10}, {0x10137, 0x1013f, 21}, {0x10140, 0x10174, 9},
+    {0x10175, 0x10178, 10}, {0x10179, 0x10189, 21}, {0x1018a, 0x1018b, 10},
+    {0x1018c, 0x1018e, 21}, {0x10190, 0x1019c, 21}, {0x101a0, 0x101a0, 21},
+    {0x101d0, 0x101fc, 21}, {0x101fd, 0x101fd, 5}, {0x10280, 0x1029c, 4},
+    {0x102a0, 0x102d0, 4}, {0x102e0, 0x102e0, 5}, {0x102e1, 0x102fb, 10},
+    {0x10300, 0x1031f, 4}, {0x10320, 0x10323, 10}, {0x1032d, 0x10340, 4},
+    {0x10341, 0x10341, 9}, {0x10342, 0x10349, 4}, {0x1034a, 0x1034a, 9},
+    {0x10350, 0x10375, 4}, {0x10376, 0x1037a, 5}, {0x10380, 0x1039d, 4},
+    {0x1039f, 0x1039f, 17}, {0x103a0, 0x103c3, 4}, {0x103c8, 0x103cf, 4},
+    {0x103d0, 0x103d0, 17}, {0x103d1, 0x103d5, 9}, {0x10400, 0x10427, 0},
+    {0x10428, 0x1044f, 1}, {0x10450, 0x1049d, 4}, {0x104a0, 0x104a9, 8},
+    {0x104b0, 0x104d3, 0}, {0x104d8, 0x104fb, 1}, {0x10500, 0x10527, 4},
+    {0x10530, 0x10563, 4}, {0x1056f, 0x1056f, 17}, {0x10570, 0x1057a, 0},
+    {0x1057c, 0x1058a, 0}, {0x1058c, 0x10592, 0}, {0x10594, 0x10595, 0},
+    {0x10597, 0x105a1, 1}, {0x105a3, 0x105b1, 1}, {0x105b3, 0x105b9, 1},
+    {0x105bb, 0x105bc, 1}, {0x10600, 0x10736, 4}, {0x10740, 0x10755, 4},
+    {0x10760, 0x10767, 4}, {0x10780, 0x10785, 3}, {0x10787, 0x107b0, 3},
+    {0x107b2, 0x107ba, 3}, {0x10800, 0x10805, 4}, {0x10808, 0x10808, 4},
+    {0x1080a, 0x10835, 4}, {0x10837, 0x10838, 4}, {0x1083c, 0x1083c, 4},
+    {0x1083f, 0x10855, 4}, {0x10857, 0x10857, 17}, {0x10858, 0x1085f, 10},
+    {0x10860, 0x10876, 4}, {0x10877, 0x10878, 21}, {0x10879, 0x1087f, 10},
+    {0x10880, 0x1089e, 4}, {0x108a7, 0x108af, 10}, {0x108e0, 0x108f2, 4},
+    {0x108f4, 0x108f5, 4}, {0x108fb, 0x108ff, 10}, {0x10900, 0x10915, 4},
+    {0x10916, 0x1091b, 10}, {0x1091f, 0x1091f, 17}, {0x10920, 0x10939, 4},
+    {0x1093f, 0x1093f, 17}, {0x10980, 0x109b7, 4}, {0x109bc, 0x109bd, 10},
+    {0x109be, 0x109bf, 4}, {0x109c0, 0x109cf, 10}, {0x109d2, 0x109ff, 10},
+    {0x10a00, 0x10a00, 4}, {0x10a01, 0x10a03, 5}, {0x10a05, 0x10a06, 5},
+    {0x10a0c, 0x10a0f, 5}, {0x10a10, 0x10a13, 4}, {0x10a15, 0x10a17, 4},
+    {0x10a19, 0x10a35, 4}, {0x10a38, 0x10a3a, 5}, {0x10a3f, 0x10a3f, 5},
+    {0x10a40, 0x10a48, 10}, {0x10a50, 0x10a58, 17}, {0x10a60, 0x10a7c, 4},
+    {0x10a7d, 0x10a7e, 10}, {0x10a7f, 0x10a7f, 17}, {0x10a80, 0x10a9c, 4},
+    {0x10a9d, 0x10a9f, 10}, {0x10ac0, 0x10ac7, 4}, {0x10ac8, 0x10ac8, 21},
+    {0x10ac9, 0x10ae4, 4}, {0x10ae5, 0x10ae6, 5}, {0x10aeb, 0x10aef, 10},
+    {0x10af0, 0x10af6, 17}, {0x10b00, 0x10b35, 4}, {0x10b39, 0x10b3f, 17},
+    {0x10b40, 0x10b55, 4}, {0x10b58, 0x10b5f, 10}, {0x10b60, 0x10b72, 4},
+    {0x10b78, 0x10b7f, 10}, {0x10b80, 0x10b91, 4}, {0x10b99, 0x10b9c, 17},
+    {0x10ba9, 0x10baf, 10}, {0x10c00, 0x10c48, 4}, {0x10c80, 0x10cb2, 0},
+    {0x10cc0, 0x10cf2, 1}, {0x10cfa, 0x10cff, 10}, {0x10d00, 0x10d23, 4},
+    {0x10d24, 0x10d27, 5}, {0x10d30, 0x10d39, 8}, {0x10e60, 0x10e7e, 10},
+    {0x10e80, 0x10ea9, 4}, {0x10eab, 0x10eac, 5}, {0x10ead, 0x10ead, 12},
+    {0x10eb0, 0x10eb1, 4}, {0x10f00, 0x10f1c, 4}, {0x10f1d, 0x10f26, 10},
+    {0x10f27, 0x10f27, 4}, {0x10f30, 0x10f45, 4}, {0x10f46, 0x10f50, 5},
+    {0x10f51, 0x10f54, 10}, {0x10f55, 0x10f59, 17}, {0x10f70, 0x10f81, 4},
+    {0x10f82, 0x10f85, 5}, {0x10f86, 0x10f89, 17}, {0x10fb0, 0x10fc4, 4},
+    {0x10fc5, 0x10fcb, 10}, {0x10fe0, 0x10ff6, 4}, {0x11000, 0x11000, 6},
+    {0x11001, 0x11001, 5}, {0x11002, 0x11002, 6}, {0x11003, 0x11037, 4},
+    {0x11038, 0x11046, 5}, {0x11047, 0x1104d, 17}, {0x11052, 0x11065, 10},
+    {0x11066, 0x1106f, 8}, {0x11070, 0x11070, 5}, {0x11071, 0x11072, 4},
+    {0x11073, 0x11074, 5}, {0x11075, 0x11075, 4}, {0x1107f, 0x11081, 5},
+    {0x11082, 0x11082, 6}, {0x11083, 0x110af, 4}, {0x110b0, 0x110b2, 6},
+    {0x110b3, 0x110b6, 5}, {0x110b7, 0x110b8, 6}, {0x110b9, 0x110ba, 5},
+    {0x110bb, 0x110bc, 17}, {0x110bd, 0x110bd, 26}, {0x110be, 0x110c1, 17},
+    {0x110c2, 0x110c2, 5}, {0x110cd, 0x110cd, 26}, {0x110d0, 0x110e8, 4},
+    {0x110f0, 0x110f9, 8}, {0x11100, 0x11102, 5}, {0x11103, 0x11126, 4},
+    {0x11127, 0x1112b, 5}, {0x1112c, 0x1112c, 6}, {0x1112d, 0x11134, 5},
+    {0x11136, 0x1113f, 8}, {0x11140, 0x11143, 17}, {0x11144, 0x11144, 4},
+    {0x11145, 0x11146, 6}, {0x11147, 0x11147, 4}, {0x11150, 0x11172, 4},
+    {0x11173, 0x11173, 5}, {0x11174, 0x11175, 17}, {0x11176, 0x11176, 4},
+    {0x11180, 0x11181, 5}, {0x11182, 0x11182, 6}, {0x11183, 0x111b2, 4},
+    {0x111b3, 0x111b5, 6}, {0x111b6, 0x111be, 5}, {0x111bf, 0x111c0, 6},
+    {0x111c1, 0x111c4, 4}, {0x111c5, 0x111c8, 17}, {0x111c9, 0x111cc, 5},
+    {0x111cd, 0x111cd, 17}, {0x111ce, 0x111ce, 6}, {0x111cf, 0x111cf, 5},
+    {0x111d0, 0x111d9, 8}, {0x111da, 0x111da, 4}, {0x111db, 0x111db, 17},
+    {0x111dc, 0x111dc, 4}, {0x111dd, 0x111df, 17}, {0x111e1, 0x111f4, 10},
+    {0x11200, 0x11211, 4}, {0x11213, 0x1122b, 4}, {0x1122c, 0x1122e, 6},
+    {0x1122f, 0x11231, 5}, {0x11232, 0x11233, 6}, {0x11234, 0x11234, 5},
+    {0x11235, 0x11235, 6}, {0x11236, 0x11237, 5}, {0x11238, 0x1123d, 17},
+    {0x1123e, 0x1123e, 5}, {0x11280, 0x11286, 4}, {0x11288, 0x11288, 4},
+    {0x1128a, 0x1128d, 4}, {0x1128f, 0x1129d, 4}, {0x1129f, 0x112a8, 4},
+    {0x112a9, 0x112a9, 17}, {0x112b0, 0x112de, 4}, {0x112df, 0x112df, 5},
+    {0x112e0, 0x112e2, 6}, {0x112e3, 0x112ea, 5}, {0x112f0, 0x112f9, 8},
+    {0x11300, 0x11301, 5}, {0x11302, 0x11303, 6}, {0x11305, 0x1130c, 4},
+    {0x1130f, 0x11310, 4}, {0x11313, 0x11328, 4}, {0x1132a, 0x11330, 4},
+    {0x11332, 0x11333, 4}, {0x11335, 0x11339, 4}, {0x1133b, 0x1133c, 5},
+    {0x1133d, 0x1133d, 4}, {0x1133e, 0x1133f, 6}, {0x11340, 0x11340, 5},
+    {0x11341, 0x11344, 6}, {0x11347, 0x11348, 6}, {0x1134b, 0x1134d, 6},
+    {0x11350, 0x11350, 4}, {0x11357, 0x11357, 6}, {0x1135d, 0x11361, 4},
+    {0x11362, 0x11363, 6}, {0x11366, 0x1136c, 5}, {0x11370, 0x11374, 5},
+    {0x11400, 0x11434, 4}, {0x11435, 0x11437, 6}, {0x11438, 0x1143f, 5},
+    {0x11440, 0x11441, 6}, {0x11442, 0x11444, 5}, {0x11445, 0x11445, 6},
+    {0x11446, 0x11446, 5}, {0x11447, 0x1144a, 4}, {0x1144b, 0x1144f, 17},
+    {0x11450, 0x11459, 8}, {0x1145a, 0x1145b, 17}, {0x1145d, 0x1145d, 17},
+    {0x1145e, 0x1145e, 5}, {0x1145f, 0x11461, 4}, {0x11480, 0x114af, 4},
+    {0x114b0, 0x114b2, 6}, {0x114b3, 0x114b8, 5}, {0x114b9, 0x114b9, 6},
+    {0x114ba, 0x114ba, 5}, {0x114bb, 0x114be, 6}, {0x114bf, 0x114c0, 5},
+    {0x114c1, 0x114c1, 6}, {0x114c2, 0x114c3, 5}, {0x114c4, 0x114c5, 4},
+    {0x114c6, 0x114c6, 17}, {0x114c7, 0x114c7, 4}, {0x114d0, 0x114d9, 8},
+    {0x11580, 0x115ae, 4}, {0x115af, 0x115b1, 6}, {0x115b2, 0x115b5, 5},
+    {0x115b8, 0x115bb, 6}, {0x115bc, 0x115bd, 5}, {0x115be, 0x115be, 6},
+    {0x115bf, 0x115c0, 5}, {0x115c1, 0x115d7, 17}, {0x115d8, 0x115db, 4},
+    {0x115dc, 0x115dd, 5}, {0x11600, 0x1162f, 4}, {0x11630, 0x11632, 6},
+    {0x11633, 0x1163a, 5}, {0x1163b, 0x1163c, 6}, {0x1163d, 0x1163d, 5},
+    {0x1163e, 0x1163e, 6}, {0x1163f, 0x11640, 5}, {0x11641, 0x11643, 17},
+    {0x11644, 0x11644, 4}, {0x11650, 0x11659, 8}, {0x11660, 0x1166c, 17},
+    {0x11680, 0x116aa, 4}, {0x116ab, 0x116ab, 5}, {0x116ac, 0x116ac, 6},
+    {0x116ad, 0x116ad, 5}, {0x116ae, 0x116af, 6}, {0x116b0, 0x116b5, 5},
+    {0x116b6, 0x116b6, 6}, {0x116b7, 0x116b7, 5}, {0x116b8, 0x116b8, 4},
+    {0x116b9, 0x116b9, 17}, {0x116c0, 0x116c9, 8}, {0x11700, 0x1171a, 4},
+    {0x1171d, 0x1171f, 5}, {0x11720, 0x11721, 6}, {0x11722, 0x11725, 5},
+    {0x11726, 0x11726, 6}, {0x11727, 0x1172b, 5}, {0x11730, 0x11739, 8},
+    {0x1173a, 0x1173b, 10}, {0x1173c, 0x1173e, 17}, {0x1173f, 0x1173f, 21},
+    {0x11740, 0x11746, 4}, {0x11800, 0x1182b, 4}, {0x1182c, 0x1182e, 6},
+    {0x1182f, 0x11837, 5}, {0x11838, 0x11838, 6}, {0x11839, 0x1183a, 5},
+    {0x1183b, 0x1183b, 17}, {0x118a0, 0x118bf, 0}, {0x118c0, 0x118df, 1},
+    {0x118e0, 0x118e9, 8}, {0x118ea, 0x118f2, 10}, {0x118ff, 0x11906, 4},
+    {0x11909, 0x11909, 4}, {0x1190c, 0x11913, 4}, {0x11915, 0x11916, 4},
+    {0x11918, 0x1192f, 4}, {0x11930, 0x11935, 6}, {0x11937, 0x11938, 6},
+    {0x1193b, 0x1193c, 5}, {0x1193d, 0x1193d, 6}, {0x1193e, 0x1193e, 5},
+    {0x1193f, 0x1193f, 4}, {0x11940, 0x11940, 6}, {0x11941, 0x11941, 4},
+    {0x11942, 0x11942, 6}, {0x11943, 0x11943, 5}, {0x11944, 0x11946, 17},
+    {0x11950, 0x11959, 8}, {0x119a0, 0x119a7, 4}, {0x119aa, 0x119d0, 4},
+    {0x119d1, 0x119d3, 6}, {0x119d4, 0x119d7, 5}, {0x119da, 0x119db, 5},
+    {0x119dc, 0x119df, 6}, {0x119e0, 0x119e0, 5}, {0x119e1, 0x119e1, 4},
+    {0x119e2, 0x119e2, 17}, {0x119e3, 0x119e3, 4}, {0x119e4, 0x119e4, 6},
+    {0x11a00, 0x11a00, 4}, {0x11a01, 0x11a0a, 5}, {0x11a0b, 0x11a32, 4},
+    {0x11a33, 0x11a38, 5}, {0x11a39, 0x11a39, 6}, {0x11a3a, 0x11a3a, 4},
+    {0x11a3b, 0x11a3e, 5}, {0x11a3f, 0x11a46, 17}, {0x11a47, 0x11a47, 5},
+    {0x11a50, 0x11a50, 4}, {0x11a51, 0x11a56, 5}, {0x11a57, 0x11a58, 6},
+    {0x11a59, 0x11a5b, 5}, {0x11a5c, 0x11a89, 4}, {0x11a8a, 0x11a96, 5},
+    {0x11a97, 0x11a97, 6}, {0x11a98, 0x11a99, 5}, {0x11a9a, 0x11a9c, 17},
+    {0x11a9d, 0x11a9d, 4}, {0x11a9e, 0x11aa2, 17}, {0x11ab0, 0x11af8, 4},
+    {0x11c00, 0x11c08, 4}, {0x11c0a, 0x11c2e, 4}, {0x11c2f, 0x11c2f, 6},
+    {0x11c30, 0x11c36, 5}, {0x11c38, 0x11c3d, 5}, {0x11c3e, 0x11c3e, 6},
+    {0x11c3f, 0x11c3f, 5}, {0x11c40, 0x11c40, 4}, {0x11c41, 0x11c45, 17},
+    {0x11c50, 0x11c59, 8}, {0x11c5a, 0x11c6c, 10}, {0x11c70, 0x11c71, 17},
+    {0x11c72, 0x11c8f, 4}, {0x11c92, 0x11ca7, 5}, {0x11ca9, 0x11ca9, 6},
+    {0x11caa, 0x11cb0, 5}, {0x11cb1, 0x11cb1, 6}, {0x11cb2, 0x11cb3, 5},
+    {0x11cb4, 0x11cb4, 6}, {0x11cb5, 0x11cb6, 5}, {0x11d00, 0x11d06, 4},
+    {0x11d08, 0x11d09, 4}, {0x11d0b, 0x11d30, 4}, {0x11d31, 0x11d36, 5},
+    {0x11d3a, 0x11d3a, 5}, {0x11d3c, 0x11d3d, 5}, {0x11d3f, 0x11d45, 5},
+    {0x11d46, 0x11d46, 4}, {0x11d47, 0x11d47, 5}, {0x11d50, 0x11d59, 8},
+    {0x11d60, 0x11d65, 4}, {0x11d67, 0x11d68, 4}, {0x11d6a, 0x11d89, 4},
+    {0x11d8a, 0x11d8e, 6}, {0x11d90, 0x11d91, 5}, {0x11d93, 0x11d94, 6},
+    {0x11d95, 0x11d95, 5}, {0x11d96, 0x11d96, 6}, {0x11d97, 0x11d97, 5},
+    {0x11d98, 0x11d98, 4}, {0x11da0, 0x11da9, 8}, {0x11ee0, 0x11ef2, 4},
+    {0x11ef3, 0x11ef4, 5}, {0x11ef5, 0x11ef6, 6}, {0x11ef7, 0x11ef8, 17},
+    {0x11fb0, 0x11fb0, 4}, {0x11fc0, 0x11fd4, 10}, {0x11fd5, 0x11fdc, 21},
+    {0x11fdd, 0x11fe0, 19}, {0x11fe1, 0x11ff1, 21}, {0x11fff, 0x11fff, 17},
+    {0x12000, 0x12399, 4}, {0x12400, 0x1246e, 9}, {0x12470, 0x12474, 17},
+    {0x12480, 0x12543, 4}, {0x12f90, 0x12ff0, 4}, {0x12ff1, 0x12ff2, 17},
+    {0x13000, 0x1342e, 4}, {0x13430, 0x13438, 26}, {0x14400, 0x14646, 4},
+    {0x16800, 0x16a38, 4}, {0x16a40, 0x16a5e, 4}, {0x16a60, 0x16a69, 8},
+    {0x16a6e, 0x16a6f, 17}, {0x16a70, 0x16abe, 4}, {0x16ac0, 0x16ac9, 8},
+    {0x16ad0, 0x16aed, 4}, {0x16af0, 0x16af4, 5}, {0x16af5, 0x16af5, 17},
+    {0x16b00, 0x16b2f, 4}, {0x16b30, 0x16b36, 5}, {0x16b37, 0x16b3b, 17},
+    {0x16b3c, 0x16b3f, 21}, {0x16b40, 0x16b43, 3}, {0x16b44, 0x16b44, 17},
+    {0x16b45, 0x16b45, 21}, {0x16b50, 0x16b59, 8}, {0x16b5b, 0x16b61, 10},
+    {0x16b63, 0x16b77, 4}, {0x16b7d, 0x16b8f, 4}, {0x16e40, 0x16e5f, 0},
+    {0x16e60, 0x16e7f, 1}, {0x16e80, 0x16e96, 10}, {0x16e97, 0x16e9a, 17},
+    {0x16f00, 0x16f4a, 4}, {0x16f4f, 0x16f4f, 5}, {0x16f50, 0x16f50, 4},
+    {0x16f51, 0x16f87, 6}, {0x16f8f, 0x16f92, 5}, {0x16f93, 0x16f9f, 3},
+    {0x16fe0, 0x16fe1, 3}, {0x16fe2, 0x16fe2, 17}, {0x16fe3, 0x16fe3, 3},
+    {0x16fe4, 0x16fe4, 5}, {0x16ff0, 0x16ff1, 6}, {0x17000, 0x187f7, 4},
+    {0x18800, 0x18cd5, 4}, {0x18d00, 0x18d08, 4}, {0x1aff0, 0x1aff3, 3},
+    {0x1aff5, 0x1affb, 3}, {0x1affd, 0x1affe, 3}, {0x1b000, 0x1b122, 4},
+    {0x1b150, 0x1b152, 4}, {0x1b164, 0x1b167, 4}, {0x1b170, 0x1b2fb, 4},
+    {0x1bc00, 0x1bc6a, 4}, {0x1bc70, 0x1bc7c, 4}, {0x1bc80, 0x1bc88, 4},
+    {0x1bc90, 0x1bc99, 4}, {0x1bc9c, 0x1bc9c, 21}, {0x1bc9d, 0x1bc9e, 5},
+    {0x1bc9f, 0x1bc9f, 17}, {0x1bca0, 0x1bca3, 26}, {0x1cf00, 0x1cf2d, 5},
+    {0x1cf30, 0x1cf46, 5}, {0x1cf50, 0x1cfc3, 21}, {0x1d000, 0x1d0f5, 21},
+    {0x1d100, 0x1d126, 21}, {0x1d129, 0x1d164, 21}, {0x1d165, 0x1d166, 6},
+    {0x1d167, 0x1d169, 5}, {0x1d16a, 0x1d16c, 21}, {0x1d16d, 0x1d172, 6},
+    {0x1d173, 0x1d17a, 26}, {0x1d17b, 0x1d182, 5}, {0x1d183, 0x1d184, 21},
+    {0x1d185, 0x1d18b, 5}, {0x1d18c, 0x1d1a9, 21}, {0x1d1aa, 0x1d1ad, 5},
+    {0x1d1ae, 0x1d1ea, 21}, {0x1d200, 0x1d241, 21}, {0x1d242, 0x1d244, 5},
+    {0x1d245, 0x1d245, 21}, {0x1d2e0, 0x1d2f3, 10}, {0x1d300, 0x1d356, 21},
+    {0x1d360, 0x1d378, 10}, {0x1d400, 0x1d419, 0}, {0x1d41a, 0x1d433, 1},
+    {0x1d434, 0x1d44d, 0}, {0x1d44e, 0x1d454, 1}, {0x1d456, 0x1d467, 1},
+    {0x1d468, 0x1d481, 0}, {0x1d482, 0x1d49b, 1}, {0x1d49c, 0x1d49c, 0},
+    {0x1d49e, 0x1d49f, 0}, {0x1d4a2, 0x1d4a2, 0}, {0x1d4a5, 0x1d4a6, 0},
+    {0x1d4a9, 0x1d4ac, 0}, {0x1d4ae, 0x1d4b5, 0}, {0x1d4b6, 0x1d4b9, 1},
+    {0x1d4bb, 0x1d4bb, 1}, {0x1d4bd, 0x1d4c3, 1}, {0x1d4c5, 0x1d4cf, 1},
+    {0x1d4d0, 0x1d4e9, 0}, {0x1d4ea, 0x1d503, 1}, {0x1d504, 0x1d505, 0},
+    {0x1d507, 0x1d50a, 0}, {0x1d50d, 0x1d514, 0}, {0x1d516, 0x1d51c, 0},
+    {0x1d51e, 0x1d537, 1}, {0x1d538, 0x1d539, 0}, {0x1d53b, 0x1d53e, 0},
+    {0x1d540, 0x1d544, 0}, {0x1d546, 0x1d546, 0}, {0x1d54a, 0x1d550, 0},
+    {0x1d552, 0x1d56b, 1}, {0x1d56c, 0x1d585, 0}, {0x1d586, 0x1d59f, 1},
+    {0x1d5a0, 0x1d5b9, 0}, {0x1d5ba, 0x1d5d3, 1}, {0x1d5d4, 0x1d5ed, 0},
+    {0x1d5ee, 0x1d607, 1}, {0x1d608, 0x1d621, 0}, {0x1d622, 0x1d63b, 1},
+    {0x1d63c, 0x1d655, 0}, {0x1d656, 0x1d66f, 1}, {0x1d670, 0x1d689, 0},
+    {0x1d68a, 0x1d6a5, 1}, {0x1d6a8, 0x1d6c0, 0}, {0x1d6c1, 0x1d6c1, 18},
+    {0x1d6c2, 0x1d6da, 1}, {0x1d6db, 0x1d6db, 18}, {0x1d6dc, 0x1d6e1, 1},
+    {0x1d6e2, 0x1d6fa, 0}, {0x1d6fb, 0x1d6fb, 18}, {0x1d6fc, 0x1d714, 1},
+    {0x1d715, 0x1d715, 18}, {0x1d716, 0x1d71b, 1}, {0x1d71c, 0x1d734, 0},
+    {0x1d735, 0x1d735, 18}, {0x1d736, 0x1d74e, 1}, {0x1d74f, 0x1d74f, 18},
+    {0x1d750, 0x1d755, 1}, {0x1d756, 0x1d76e, 0}, {0x1d76f, 0x1d76f, 18},
+    {0x1d770, 0x1d788, 1}, {0x1d789, 0x1d789, 18}, {0x1d78a, 0x1d78f, 1},
+    {0x1d790, 0x1d7a8, 0}, {0x1d7a9, 0x1d7a9, 18}, {0x1d7aa, 0x1d7c2, 1},
+    {0x1d7c3, 0x1d7c3, 18}, {0x1d7c4, 0x1d7c9, 1}, {0x1d7ca, 0x1d7ca, 0},
+    {0x1d7cb, 0x1d7cb, 1}, {0x1d7ce, 0x1d7ff, 8}, {0x1d800, 0x1d9ff, 21},
+    {0x1da00, 0x1da36, 5}, {0x1da37, 0x1da3a, 21}, {0x1da3b, 0x1da6c, 5},
+    {0x1da6d, 0x1da74, 21}, {0x1da75, 0x1da75, 5}, {0x1da76, 0x1da83, 21},
+    {0x1da84, 0x1da84, 5}, {0x1da85, 0x1da86, 21}, {0x1da87, 0x1da8b, 17},
+    {0x1da9b, 0x1da9f, 5}, {0x1daa1, 0x1daaf, 5}, {0x1df00, 0x1df09, 1},
+    {0x1df0a, 0x1df0a, 4}, {0x1df0b, 0x1df1e, 1}, {0x1e000, 0x1e006, 5},
+    {0x1e008, 0x1e018, 5}, {0x1e01b, 0x1e021, 5}, {0x1e023, 0x1e024, 5},
+    {0x1e026, 0x1e02a, 5}, {0x1e100, 0x1e12c, 4}, {0x1e130, 0x1e136, 5},
+    {0x1e137, 0x1e13d, 3}, {0x1e140, 0x1e149, 8}, {0x1e14e, 0x1e14e, 4},
+    {0x1e14f, 0x1e14f, 21}, {0x1e290, 0x1e2ad, 4}, {0x1e2ae, 0x1e2ae, 5},
+    {0x1e2c0, 0x1e2eb, 4}, {0x1e2ec, 0x1e2ef, 5}, {0x1e2f0, 0x1e2f9, 8},
+    {0x1e2ff, 0x1e2ff, 19}, {0x1e7e0, 0x1e7e6, 4}, {0x1e7e8, 0x1e7eb, 4},
+    {0x1e7ed, 0x1e7ee, 4}, {0x1e7f0, 0x1e7fe, 4}, {0x1e800, 0x1e8c4, 4},
+    {0x1e8c7, 0x1e8cf, 10}, {0x1e8d0, 0x1e8d6, 5}, {0x1e900, 0x1e921, 0},
+    {0x1e922, 0x1e943, 1}, {0x1e944, 0x1e94a, 5}, {0x1e94b, 0x1e94b, 3},
+    {0x1e950, 0x1e959, 8}, {0x1e95e, 0x1e95f, 17}, {0x1ec71, 0x1ecab, 10},
+    {0x1ecac, 0x1ecac, 21}, {0x1ecad, 0x1ecaf, 10}, {0x1ecb0, 0x1ecb0, 19},
+    {0x1ecb1, 0x1ecb4, 10}, {0x1ed01, 0x1ed2d, 10}, {0x1ed2e, 0x1ed2e, 21},
+    {0x1ed2f, 0x1ed3d, 10}, {0x1ee00, 0x1ee03, 4}, {0x1ee05, 0x1ee1f, 4},
+    {0x1ee21, 0x1ee22, 4}, {0x1ee24, 0x1ee24, 4}, {0x1ee27, 0x1ee27, 4},
+    {0x1ee29, 0x1ee32, 4}, {0x1ee34, 0x1ee37, 4}, {0x1ee39, 0x1ee39, 4},
+    {0x1ee3b, 0x1ee3b, 4}, {0x1ee42, 0x1ee42, 4}, {0x1ee47, 0x1ee47, 4},
+    {0x1ee49, 0x1ee49, 4}, {0x1ee4b, 0x1ee4b, 4}, {0x1ee4d, 0x1ee4f, 4},
+    {0x1ee51, 0x1ee52, 4}, {0x1ee54, 0x1ee54, 4}, {0x1ee57, 0x1ee57, 4},
+    {0x1ee59, 0x1ee59, 4}, {0x1ee5b, 0x1ee5b, 4}, {0x1ee5d, 0x1ee5d, 4},
+    {0x1ee5f, 0x1ee5f, 4}, {0x1ee61, 0x1ee62, 4}, {0x1ee64, 0x1ee64, 4},
+    {0x1ee67, 0x1ee6a, 4}, {0x1ee6c, 0x1ee72, 4}, {0x1ee74, 0x1ee77, 4},
+    {0x1ee79, 0x1ee7c, 4}, {0x1ee7e, 0x1ee7e, 4}, {0x1ee80, 0x1ee89, 4},
+    {0x1ee8b, 0x1ee9b, 4}, {0x1eea1, 0x1eea3, 4}, {0x1eea5, 0x1eea9, 4},
+    {0x1eeab, 0x1eebb, 4}, {0x1eef0, 0x1eef1, 18}, {0x1f000, 0x1f02b, 21},
+    {0x1f030, 0x1f093, 21}, {0x1f0a0, 0x1f0ae, 21}, {0x1f0b1, 0x1f0bf, 21},
+    {0x1f0c1, 0x1f0cf, 21}, {0x1f0d1, 0x1f0f5, 21}, {0x1f100, 0x1f10c, 10},
+    {0x1f10d, 0x1f1ad, 21}, {0x1f1e6, 0x1f202, 21}, {0x1f210, 0x1f23b, 21},
+    {0x1f240, 0x1f248, 21}, {0x1f250, 0x1f251, 21}, {0x1f260, 0x1f265, 21},
+    {0x1f300, 0x1f3fa, 21}, {0x1f3fb, 0x1f3ff, 20}, {0x1f400, 0x1f6d7, 21},
+    {0x1f6dd, 0x1f6ec, 21}, {0x1f6f0, 0x1f6fc, 21}, {0x1f700, 0x1f773, 21},
+    {0x1f780, 0x1f7d8, 21}, {0x1f7e0, 0x1f7eb, 21}, {0x1f7f0, 0x1f7f0, 21},
+    {0x1f800, 0x1f80b, 21}, {0x1f810, 0x1f847, 21}, {0x1f850, 0x1f859, 21},
+    {0x1f860, 0x1f887, 21}, {0x1f890, 0x1f8ad, 21}, {0x1f8b0, 0x1f8b1, 21},
+    {0x1f900, 0x1fa53, 21}, {0x1fa60, 0x1fa6d, 21}, {0x1fa70, 0x1fa74, 21},
+    {0x1fa78, 0x1fa7c, 21}, {0x1fa80, 0x1fa86, 21}, {0x1fa90, 0x1faac, 21},
+    {0x1fab0, 0x1faba, 21}, {0x1fac0, 0x1fac5, 21}, {0x1fad0, 0x1fad9, 21},
+    {0x1fae0, 0x1fae7, 21}, {0x1faf0, 0x1faf6, 21}, {0x1fb00, 0x1fb92, 21},
+    {0x1fb94, 0x1fbca, 21}, {0x1fbf0, 0x1fbf9, 8}, {0x20000, 0x2a6df, 4},
+    {0x2a700, 0x2b738, 4}, {0x2b740, 0x2b81d, 4}, {0x2b820, 0x2cea1, 4},
+    {0x2ceb0, 0x2ebe0, 4}, {0x2f800, 0x2fa1d, 4}, {0x30000, 0x3134a, 4},
+    {0xe0001, 0xe0001, 26}, {0xe0020, 0xe007f, 26}, {0xe0100, 0xe01ef, 5},
+    {0xf0000, 0xffffd, 28}, {0x100000, 0x10fffd, 28},
+};
+
+const size_t categoryRangeCount =
+    sizeof(categoryRanges) / sizeof(categoryRanges[0]);
+
+//
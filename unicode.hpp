@@ -0,0 +1,100 @@
+/**
+ * @file unicode.hpp
+ *
+ * @brief Declares the `CodePointSet` class, used by the pattern analyser and
+ * the automaton to work with sets of Unicode characters and their UTF-8
+ * encodings.
+ *
+ * Copyright Finley Owen, 2025. All rights reserved.
+ */
+
+#ifndef __UNICODE_HPP__
+#define __UNICODE_HPP__
+
+#include <bitset>
+#include <string>
+#include <utility>
+#include <vector>
+using namespace std;
+
+/// @brief A range of bytes, `first` to `second` inclusive.
+typedef pair<unsigned char, unsigned char> ByteRange;
+
+/// @brief A set of Unicode code points, stored as sorted, disjoint, non-adjacent
+/// ranges.
+class CodePointSet
+{
+private:
+    /// @brief The ranges of code points in the set, `first` to `second`
+    /// inclusive.
+    vector<pair<unsigned int, unsigned int>> ranges;
+
+public:
+    /// @brief The highest Unicode code point.
+    static const unsigned int maxCodePoint = 0x10ffff;
+
+    /// @brief Add a range of code points to the set.
+    /// @param lo The first code point in the range.
+    /// @param hi The last code point in the range.
+    void add(unsigned int lo, unsigned int hi);
+
+    /// @brief Add a single code point to the set.
+    /// @param c The code point.
+    void add(unsigned int c);
+
+    /// @brief Add the code points in another set to this set.
+    /// @param other The other set.
+    void add(const CodePointSet &other);
+
+    /// @brief Replace the set with the code points that aren't in it.
+    void invert();
+
+    /// @brief Indicates whether the set contains a code point.
+    /// @param c The code point.
+    /// @return `true` if `c` is in the set, else `false`.
+    bool contains(unsigned int c) const;
+
+    /// @brief Indicates whether the set is empty.
+    /// @return `true` if the set is empty, else `false`.
+    bool empty() const;
+
+    /// @brief Get the ranges of code points in the set.
+    /// @return The ranges, sorted, disjoint and non-adjacent.
+    const vector<pair<unsigned int, unsigned int>> &getRanges() const;
+
+    /// @brief Get the bytes that the UTF-8 encodings of the code points in the
+    /// set start with.
+    /// @return The first bytes.
+    bitset<256> firstBytes() const;
+
+    /// @brief Get the length in bytes of the longest UTF-8 encoding of a code
+    /// point in the set.
+    /// @return The length, from 1 to 4, or 0 if the set is empty.
+    unsigned int maxEncodedLength() const;
+
+    /// @brief Convert the set to sequences of byte ranges matching the UTF-8
+    /// encodings of its code points: a string of bytes is the encoding of a
+    /// code point in the set if and only if it matches exactly one sequence,
+    /// byte by byte. Surrogates, which have no UTF-8 encoding, are left out.
+    /// @return The sequences, in order of the code points they match.
+    vector<vector<ByteRange>> utf8Sequences() const;
+
+    /// @brief Look up a Unicode general category by its short name (e.g. "Lu"
+    /// or "L") or long name (e.g. "Uppercase_Letter" or "Letter"), as used in
+    /// `\p{...}`. "LC" and "L&" name the cased letters.
+    /// @param name The name of the category.
+    /// @param set On success, the code points in the category.
+    /// @return `true` if the category is known, else `false`.
+    static bool category(const string &name, CodePointSet &set);
+
+    /// @brief Decode the UTF-8 encoding of a code point. Invalid and
+    /// truncated sequences decode one byte at a time, as the code point with
+    /// the byte's value.
+    /// @param s The string to decode from.
+    /// @param position Position of the encoding; on return, the position
+    /// after it.
+    /// @return The code point.
+    static unsigned int decode(const string &s, size_t &position);
+};
+
+#endif